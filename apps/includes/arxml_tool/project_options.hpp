@@ -0,0 +1,25 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <arxml/project.hpp>
+
+namespace arxml_tool {
+
+    // Project filters given with the global --include, --exclude and --package flags
+    struct ProjectOptions {
+        std::vector<std::string> include_patterns;
+        std::vector<std::string> exclude_patterns;
+        std::vector<std::string> package_prefixes;
+
+        static ProjectOptions& instance();
+
+        [[nodiscard]] arxml::project::ModelProject createProject() const;
+    };
+
+}
@@ -9,11 +9,10 @@ int main(int argc, const char* argv[]) {
     selector_builder.build();
 
     try {
-        selector.execute();
+        return selector.execute();
     }
     catch (std::exception& e) {
         std::cerr << e.what() << std::endl;
         return EXIT_FAILURE;
     }
-    return EXIT_SUCCESS;
 }
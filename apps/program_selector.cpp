@@ -4,10 +4,37 @@
 
 #include "arxml_tool/program_selector.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 
+#include <arxml/utilities/diagnostics.hpp>
+#include <arxml/utilities/instrumentation.hpp>
+#include <arxml/utilities/tracing.hpp>
+
+#include "arxml_tool/project_options.hpp"
+
 namespace arxml_tool {
 
+    namespace {
+        // False when some input had to be skipped
+        bool reportDiagnostics() {
+            using arxml::utilities::Diagnostics;
+            using arxml::utilities::Severity;
+            const auto& diagnostics = Diagnostics::instance();
+            auto all = diagnostics.get();
+            if (all.empty()) {
+                return true;
+            }
+            for (const auto& diagnostic: all) {
+                std::cerr << diagnostic << std::endl;
+            }
+            std::cerr << diagnostics.count(Severity::ERROR) << " errors, " << diagnostics.count(Severity::WARNING)
+                      << " warnings" << std::endl;
+            return diagnostics.count(Severity::ERROR) == 0;
+        }
+    }
+
     ProgramSelector::ProgramSelector(int argc, const char* argv[]) {
         for (int it = 0; it < argc; ++it) {
             m_argv.emplace_back(argv[it]);
@@ -15,9 +42,50 @@ namespace arxml_tool {
     }
 
     int ProgramSelector::execute() {
+        using arxml::utilities::instrumentation::Profiler;
+        auto profile_flag = std::find(m_argv.begin(), m_argv.end(), "--profile");
+        bool profile = profile_flag != m_argv.end();
+        if (profile) {
+            m_argv.erase(profile_flag);
+            if (not arxml::utilities::instrumentation::PROFILING_AVAILABLE) {
+                std::cerr << "Profiling is not available, build with ARXML_ENABLE_PROFILING" << std::endl;
+            }
+            Profiler::instance().enable(true);
+        }
+        using arxml::utilities::tracing::TraceRecorder;
+        std::string trace_file;
+        auto trace_flag = std::find(m_argv.begin(), m_argv.end(), "--trace");
+        if (trace_flag != m_argv.end() and std::next(trace_flag) == m_argv.end()) {
+            std::cerr << "Missing FILE after --trace" << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (trace_flag != m_argv.end()) {
+            trace_file = *std::next(trace_flag);
+            m_argv.erase(trace_flag, std::next(trace_flag, 2));
+            if (not arxml::utilities::instrumentation::PROFILING_AVAILABLE) {
+                std::cerr << "Tracing is not available, build with ARXML_ENABLE_PROFILING" << std::endl;
+            }
+            TraceRecorder::instance().enable(true);
+        }
+        auto& options = ProjectOptions::instance();
+        for (auto [flag, values]: {std::pair{"--include", &options.include_patterns},
+                                   std::pair{"--exclude", &options.exclude_patterns},
+                                   std::pair{"--package", &options.package_prefixes}}) {
+            auto it = std::find(m_argv.begin(), m_argv.end(), flag);
+            while (it != m_argv.end() and std::next(it) != m_argv.end()) {
+                values->push_back(*std::next(it));
+                it = m_argv.erase(it, std::next(it, 2));
+                it = std::find(it, m_argv.end(), flag);
+            }
+        }
         if (m_argv.size() == 1 || (m_argv.size() > 2 and m_argv[1] == "help")) {
             std::cout << "Available commands:" << std::endl;
             std::cout << "help - lists of the available tools" << std::endl;
+            std::cout << "--profile - prints per-phase timing report of the command" << std::endl;
+            std::cout << "--trace FILE - writes timeline of the command in Chrome trace format" << std::endl;
+            std::cout << "--include GLOB - loads only model files matching one of the given patterns" << std::endl;
+            std::cout << "--exclude GLOB - skips model files matching the pattern" << std::endl;
+            std::cout << "--package PREFIX - builds only packages under one of the given package paths" << std::endl;
             std::for_each(m_subprograms.begin(), m_subprograms.end(), [](std::unique_ptr<AbstractSubProgram>& program) {
                 std::cout << program->getName() << " - " << program->description() << std::endl;
             });
@@ -27,7 +95,15 @@ namespace arxml_tool {
         std::for_each(m_subprograms.begin(), m_subprograms.end(), [&](std::unique_ptr<AbstractSubProgram>& program) {
            program->execute(subcommands);
         });
-        return EXIT_SUCCESS;
+        auto succeeded = reportDiagnostics();
+        if (profile and arxml::utilities::instrumentation::PROFILING_AVAILABLE) {
+            Profiler::instance().report(std::cerr);
+        }
+        if (not trace_file.empty()) {
+            std::ofstream trace(trace_file);
+            TraceRecorder::instance().write(trace);
+        }
+        return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
 }
@@ -0,0 +1,28 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "arxml_tool/project_options.hpp"
+
+namespace arxml_tool {
+
+    ProjectOptions& ProjectOptions::instance() {
+        static ProjectOptions options;
+        return options;
+    }
+
+    arxml::project::ModelProject ProjectOptions::createProject() const {
+        arxml::project::ModelProject project;
+        for (const auto& it: include_patterns) {
+            project.addIncludePattern(it);
+        }
+        for (const auto& it: exclude_patterns) {
+            project.addExcludePattern(it);
+        }
+        for (const auto& it: package_prefixes) {
+            project.addPackageFilter(it);
+        }
+        return project;
+    }
+
+}
@@ -0,0 +1,70 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "diff_subprogram.hpp"
+
+#include <iostream>
+#include <sstream>
+
+#include <arxml/helpers/diff.hpp>
+#include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    namespace {
+        char marker(arxml::helpers::DifferenceKind kind) {
+            switch (kind) {
+                case arxml::helpers::DifferenceKind::ADDED: return '+';
+                case arxml::helpers::DifferenceKind::REMOVED: return '-';
+                default: return '~';
+            }
+        }
+    }
+
+    void DiffSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() < 4) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode and two paths or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        auto old_project = ProjectOptions::instance().createProject();
+        auto new_project = ProjectOptions::instance().createProject();
+        if (not old_project.addDirectory(args[2])) {
+            throw std::runtime_error("Directory " + args[2] + " does not exist");
+        }
+        if (not new_project.addDirectory(args[3])) {
+            throw std::runtime_error("Directory " + args[3] + " does not exist");
+        }
+
+        auto differences = arxml::helpers::ModelComparator::compare(old_project, new_project);
+        if (differences.empty()) {
+            std::cout << "Models are equal\n";
+            return;
+        }
+        for (const auto& difference: differences) {
+            std::cout << marker(difference.kind) << " " << difference.path << " (" << difference.description << ")\n";
+        }
+        std::cout << differences.size() << " difference(s) found" << std::endl;
+    }
+
+    std::string DiffSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Diff compares two models element by element.\n"
+           << "Added entries are marked with '+', removed with '-' and changed with '~'.\n"
+           << "Attributes are reported as ELEMENT_PATH@ATTRIBUTE.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir OLD_MODEL_DIR_NAME NEW_MODEL_DIR_NAME\n\n";
+        ss << "Example:\n./arxml_tool diff dir data_v1/ data_v2/";
+        return ss.str();
+    }
+
+}
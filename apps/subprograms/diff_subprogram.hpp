@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class DiffSubProgram : public AbstractSubProgram {
+    public:
+        DiffSubProgram()
+                : AbstractSubProgram("diff") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "compare two models and list changed elements"; }
+        std::string help() override;
+    };
+
+}
@@ -10,6 +10,7 @@
 #include <arxml/utilities/parser_facade.hpp>
 #include <arxml/printer.hpp>
 #include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
 
 namespace arxml_tool {
 
@@ -28,7 +29,7 @@ namespace arxml_tool {
         std::string path = args[2];
         // TODO: Check correctenss of the arguments and paths
         arxml::utilities::DefaultParserFacade parser;
-        arxml::project::ModelProject project;
+        auto project = ProjectOptions::instance().createProject();
         project.addDirectory(path);
         arxml::project::ModelProject::openModelFromProject(project, parser);
         auto result = parser.getModel();
@@ -0,0 +1,178 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "export_subprogram.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include <arxml/utilities/parser_facade.hpp>
+#include <arxml/helpers/columnar.hpp>
+#include <arxml/printer.hpp>
+#include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    namespace {
+        enum class ExportFormat {
+            JSON,
+            NDJSON,
+            CSV,
+            ARROW
+        };
+
+        ExportFormat parseFormat(const std::string& format) {
+            if (format == "json") {
+                return ExportFormat::JSON;
+            }
+            if (format == "ndjson") {
+                return ExportFormat::NDJSON;
+            }
+            if (format == "csv") {
+                return ExportFormat::CSV;
+            }
+            if (format == "arrow") {
+                return ExportFormat::ARROW;
+            }
+            throw std::logic_error("Unknown export format " + format + "! Expected json, ndjson, csv or arrow.");
+        }
+
+        arxml::printer::JsonFormat jsonFormat(ExportFormat format) {
+            return format == ExportFormat::NDJSON ? arxml::printer::JsonFormat::NDJSON : arxml::printer::JsonFormat::JSON;
+        }
+
+        void writeTable(const arxml::helpers::Table& table, const std::filesystem::path& destination, ExportFormat format) {
+            std::ofstream stream(destination, std::ios::binary);
+            if (not stream) {
+                throw std::runtime_error("Cannot write exported table to " + destination.string());
+            }
+            if (format == ExportFormat::CSV) {
+                arxml::helpers::write_csv(stream, table);
+            }
+            else {
+                arxml::helpers::write_arrow_ipc(stream, table);
+            }
+            std::cout << "Written " << destination.string() << " (" << table.rows() << " rows)\n";
+        }
+
+        // Elements and references tables are gathered in one traversal
+        void exportTables(const arxml::model::IAutosarModel& model, const std::filesystem::path& output,
+                          ExportFormat format) {
+            auto tables = arxml::helpers::tabulate_model(model);
+            auto extension = format == ExportFormat::CSV ? ".csv" : ".arrows";
+            std::filesystem::create_directories(output);
+            writeTable(tables.elements, output / (std::string("elements") + extension), format);
+            writeTable(tables.references, output / (std::string("references") + extension), format);
+        }
+
+        void exportEntry(const arxml::model::IModelEntry& entry, const std::filesystem::path& destination,
+                         arxml::printer::JsonFormat format) {
+            std::filesystem::create_directories(destination.parent_path());
+            std::ofstream stream(destination, std::ios::binary);
+            if (not stream) {
+                throw std::runtime_error("Cannot write exported model to " + destination.string());
+            }
+            arxml::printer::JsonPrinter printer(stream, format);
+            printer.print(entry);
+        }
+
+        // Every model entry is written to its own file; entries are shared between worker threads
+        void exportEntries(const arxml::model::IAutosarModel& model, const std::filesystem::path& path,
+                           const std::filesystem::path& output, arxml::printer::JsonFormat format) {
+            std::vector<std::pair<const arxml::model::IModelEntry*, std::filesystem::path>> jobs;
+            auto extension = format == arxml::printer::JsonFormat::JSON ? ".json" : ".ndjson";
+            for (const auto& entry: model.getModelUnits()) {
+                auto destination = output / std::filesystem::relative(entry.getEntryName(), path);
+                jobs.emplace_back(&entry, destination.replace_extension(extension));
+            }
+
+            std::atomic<std::size_t> next{0};
+            auto worker = [&]() {
+                for (auto it = next++; it < jobs.size(); it = next++) {
+                    exportEntry(*jobs[it].first, jobs[it].second, format);
+                }
+            };
+            auto threads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), jobs.size());
+            std::vector<std::future<void>> workers;
+            for (std::size_t it = 0; it < threads; ++it) {
+                workers.push_back(std::async(std::launch::async, worker));
+            }
+            for (auto& it: workers) {
+                it.get();
+            }
+            for (const auto& [entry, destination]: jobs) {
+                std::cout << "Written " << destination.string() << "\n";
+            }
+        }
+    }
+
+    void ExportSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() < 3) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode and path or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        std::filesystem::path path = args[2];
+        auto format = ExportFormat::JSON;
+        std::vector<std::string> rest(args.begin() + 3, args.end());
+        if (rest.size() >= 2 and rest[0] == "--format") {
+            format = parseFormat(rest[1]);
+            rest.erase(rest.begin(), rest.begin() + 2);
+        }
+        if (rest.size() > 1) {
+            throw std::logic_error("Invalid number of the arguments! Expected at most one output directory.");
+        }
+
+        arxml::utilities::DefaultParserFacade parser;
+        auto project = ProjectOptions::instance().createProject();
+        project.addDirectory(path.string());
+        arxml::project::ModelProject::openModelFromProject(project, parser);
+        auto model = parser.getModel();
+
+        if (format == ExportFormat::CSV or format == ExportFormat::ARROW) {
+            if (rest.empty()) {
+                throw std::logic_error("Invalid number of the arguments! Tables require the output directory.");
+            }
+            exportTables(*model, rest[0], format);
+            return;
+        }
+        if (rest.empty()) {
+            arxml::printer::JsonPrinter printer(std::cout, jsonFormat(format));
+            printer.print(*model);
+            return;
+        }
+        exportEntries(*model, path, rest[0], jsonFormat(format));
+    }
+
+    std::string ExportSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Export writes the model as JSON document or as NDJSON with one record per top level\n"
+           << "element. Without output directory the whole model is written to the standard output, otherwise\n"
+           << "every model file is exported to its own file, in parallel.\n"
+           << "Formats csv and arrow write flat tables instead: elements.* (path, tag, parent, file) of named\n"
+           << "elements and references.* (source, dest, target) of reference edges; arrow is IPC stream format.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir MODEL_DIR_NAME [--format json|ndjson] [OUTPUT_DIR]\n"
+            << "3 | dir MODEL_DIR_NAME --format csv|arrow OUTPUT_DIR\n\n";
+        ss << "Examples:\n./arxml_tool export dir data/ --format ndjson\n";
+        ss << "./arxml_tool export dir data/ --format json exported/\n";
+        ss << "./arxml_tool export dir data/ --format arrow tables/";
+        return ss.str();
+    }
+
+}
@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class ExportSubProgram : public AbstractSubProgram {
+    public:
+        ExportSubProgram()
+                : AbstractSubProgram("export") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "export the model as JSON, NDJSON or CSV/Arrow tables"; }
+        std::string help() override;
+    };
+
+}
@@ -6,10 +6,18 @@
 
 #include <arxml/utilities/parser_facade.hpp>
 #include <arxml/helpers/finders.hpp>
+#include <arxml/helpers/namespace_index.hpp>
+#include <arxml/helpers/path_trie.hpp>
+#include <arxml/helpers/query.hpp>
+#include <arxml/helpers/text_index.hpp>
+#include <arxml/utilities/tracing.hpp>
+#include <arxml/dfs/multiplexer.hpp>
 #include <arxml/dfs/traversal.hpp>
 #include <arxml/printer.hpp>
 #include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <map>
@@ -19,13 +27,16 @@ namespace arxml_tool {
 
         void find_by_tag(const std::string& path, const std::string& tag) {
             arxml::utilities::DefaultParserFacade parser;
-            arxml::project::ModelProject project;
+            auto project = ProjectOptions::instance().createProject();
             project.addDirectory(path);
             arxml::project::ModelProject::openModelFromProject(project, parser);
             auto model = parser.getModel();
-            std::map<std::string, arxml::model::INamedAutosarElement&> result;
+            std::map<std::string, const arxml::model::INamedAutosarElement&> result;
             arxml::helpers::ElementByTagFinder callback(result, tag);
-            arxml::dfs::traverse_model(*model, callback);
+            {
+                ARXML_TRACE_SCOPE("finder by_tag", tag);
+                arxml::dfs::traverse_model(*model, callback);
+            }
             std::cout << "Found following entries with " << tag << " tag:\n";
             if (result.empty()) { std::cout << "none\n"; }
             else {
@@ -37,29 +48,46 @@ namespace arxml_tool {
 
         void find_by_id(const std::string& path, const std::string& id) {
             arxml::utilities::DefaultParserFacade parser;
-            arxml::project::ModelProject project;
+            auto project = ProjectOptions::instance().createProject();
             project.addDirectory(path);
+            // Only the branch leading to the element is built, unless packages were already limited by the user
+            if (id.starts_with('/') and project.getPackageFilter().empty()) {
+                project.addPackageFilter(id);
+            }
             arxml::project::ModelProject::openModelFromProject(project, parser);
             auto model = parser.getModel();
-            std::vector<std::reference_wrapper<arxml::model::INamedAutosarElement>> result;
-            arxml::helpers::ElementByIdFinder callback(result, id);
-            arxml::dfs::traverse_model(*model, callback);
+            auto index = arxml::helpers::NamespaceIndex::build(*model);
+            const arxml::model::INamedAutosarElement* result = nullptr;
+            {
+                ARXML_TRACE_SCOPE("finder by_id", id);
+                if (auto node = index.find(id.starts_with('/') ? id : "/" + id)) {
+                    for (const auto& definition: index[*node].definitions) {
+                        if (definition.element) {
+                            result = definition.element;
+                            break;
+                        }
+                    }
+                }
+            }
             std::cout << "Found following entry on path " << id << ":\n";
-            if (result.empty()) { std::cout << "none\n"; }
+            if (result == nullptr) { std::cout << "none\n"; }
             else {
-                arxml::printer::TreePrinter::stdout_dump(result[0]);
+                arxml::printer::TreePrinter::stdout_dump(*result);
             }
         }
 
         void find_by_ref(const std::string& path, const std::string& id) {
             arxml::utilities::DefaultParserFacade parser;
-            arxml::project::ModelProject project;
+            auto project = ProjectOptions::instance().createProject();
             project.addDirectory(path);
             arxml::project::ModelProject::openModelFromProject(project, parser);
             auto model = parser.getModel();
             std::vector<std::string> result;
             arxml::helpers::ElementByReferenceFinder callback(result, id);
-            arxml::dfs::traverse_model(*model, callback);
+            {
+                ARXML_TRACE_SCOPE("finder by_ref", id);
+                arxml::dfs::traverse_model(*model, callback);
+            }
             std::cout << "Object " << id << " is referenced in entries:\n";
             if (result.empty()) {
                 std::cout << "none\n";
@@ -68,15 +96,163 @@ namespace arxml_tool {
             int position = 1;
             for (const auto& reference: result) {
                 std::cout << position << ". Reference found in element " << reference << std::endl;
-                std::optional<std::pair<std::string, arxml::model::INamedAutosarElement&>> root;
+                std::optional<std::pair<std::string, const arxml::model::INamedAutosarElement&>> root;
                 arxml::helpers::RootElementFinder root_finder(root, reference);
-                arxml::dfs::traverse_model(*model, root_finder);
+                {
+                    ARXML_TRACE_SCOPE("finder root", reference);
+                    arxml::dfs::traverse_model(*model, root_finder);
+                }
                 std::cout << "Root element: " << root.value().first << std::endl;
                 arxml::printer::TreePrinter::stdout_dump(root.value().second);
                 std::cout << std::endl;
                 ++position;
             }
         }
+
+        void find_by_query(const std::string& path, const std::vector<std::string>& queries) {
+            std::vector<arxml::helpers::CompiledQuery> compiled;
+            for (const auto& query: queries) {
+                compiled.push_back(arxml::helpers::CompiledQuery::compile(query));
+            }
+            arxml::utilities::DefaultParserFacade parser;
+            auto project = ProjectOptions::instance().createProject();
+            project.addDirectory(path);
+            arxml::project::ModelProject::openModelFromProject(project, parser);
+            auto model = parser.getModel();
+            std::vector<std::vector<arxml::helpers::QueryMatch>> results(compiled.size());
+            std::vector<arxml::helpers::QueryMatcher> matchers;
+            matchers.reserve(compiled.size());
+            arxml::dfs::TraversalMultiplexer multiplexer;
+            for (std::size_t it = 0; it < compiled.size(); ++it) {
+                multiplexer.addCallback(matchers.emplace_back(compiled[it], results[it]));
+            }
+            {
+                [[maybe_unused]] std::string_view detail = queries.size() == 1 ? std::string_view(queries[0])
+                                                                               : "multiple queries";
+                ARXML_TRACE_SCOPE("finder query", detail);
+                arxml::dfs::traverse_model(*model, multiplexer);
+            }
+            for (std::size_t it = 0; it < compiled.size(); ++it) {
+                std::cout << "Found following entries matching " << queries[it] << ":\n";
+                if (results[it].empty()) {
+                    std::cout << "none\n";
+                }
+                for (const auto& match: results[it]) {
+                    std::cout << match.path;
+                    if (not match.value.empty()) {
+                        std::cout << " = " << match.value;
+                    }
+                    std::cout << std::endl;
+                }
+            }
+        }
+
+        void find_by_text(const std::string& path, const std::vector<std::string>& patterns) {
+            arxml::utilities::DefaultParserFacade parser;
+            auto project = ProjectOptions::instance().createProject();
+            project.addDirectory(path);
+            arxml::project::ModelProject::openModelFromProject(project, parser);
+            auto model = parser.getModel();
+            auto index = arxml::helpers::TextIndex::build(*model);
+            for (const auto& pattern: patterns) {
+                std::vector<arxml::helpers::TextMatch> result;
+                {
+                    ARXML_TRACE_SCOPE("finder text", pattern);
+                    result = index.find(pattern);
+                }
+                std::cout << "Found following entries containing " << pattern << ":\n";
+                if (result.empty()) {
+                    std::cout << "none\n";
+                }
+                for (const auto& match: result) {
+                    std::cout << match.path << " = " << match.text << "\n";
+                }
+            }
+        }
+
+        std::string describe(const arxml::helpers::NamespaceIndex::Definition& definition) {
+            return definition.element ? definition.element->getTag() : std::string("package");
+        }
+
+        void show_merged(const std::string& path, const std::vector<std::string>& ids) {
+            arxml::utilities::DefaultParserFacade parser;
+            auto project = ProjectOptions::instance().createProject();
+            project.addDirectory(path);
+            arxml::project::ModelProject::openModelFromProject(project, parser);
+            auto model = parser.getModel();
+            auto index = arxml::helpers::NamespaceIndex::build(*model);
+            for (const auto& id: ids) {
+                std::cout << "Merged view of " << id << ":\n";
+                auto node = index.find(id);
+                if (not node) {
+                    std::cout << "none\n";
+                    continue;
+                }
+                for (const auto& definition: index[*node].definitions) {
+                    std::cout << describe(definition) << " defined in " << definition.entry->getEntryName() << "\n";
+                }
+                for (auto child: index[*node].children) {
+                    const auto& definitions = index[child].definitions;
+                    std::cout << index.path(child) << " (" << describe(definitions.front());
+                    if (definitions.size() > 1) {
+                        std::cout << ", " << definitions.size() << " definitions";
+                    }
+                    std::cout << ")\n";
+                }
+            }
+        }
+
+        void find_duplicates(const std::string& path, const std::string& prefix) {
+            arxml::utilities::DefaultParserFacade parser;
+            parser.enableContentHashing();
+            auto project = ProjectOptions::instance().createProject();
+            project.addDirectory(path);
+            arxml::project::ModelProject::openModelFromProject(project, parser);
+            auto model = parser.getModel();
+            auto index = arxml::helpers::NamespaceIndex::build(*model);
+            std::cout << "Found following paths defined more than once under " << prefix << ":\n";
+            bool found = false;
+            for (const auto& duplicate: index.getDuplicates()) {
+                auto duplicate_path = index.path(duplicate.node);
+                if (prefix != "/" and duplicate_path != prefix and not duplicate_path.starts_with(prefix + "/")) {
+                    continue;
+                }
+                found = true;
+                std::cout << duplicate_path << (duplicate.conflicting ? " conflicting:" : " identical:");
+                for (const auto& definition: index[duplicate.node].definitions) {
+                    std::cout << " " << definition.entry->getEntryName() << " (" << describe(definition) << ")";
+                }
+                std::cout << std::endl;
+            }
+            if (not found) {
+                std::cout << "none\n";
+            }
+        }
+
+        void complete_paths(const std::string& path, const std::vector<std::string>& prefixes) {
+            arxml::utilities::DefaultParserFacade parser;
+            auto project = ProjectOptions::instance().createProject();
+            project.addDirectory(path);
+            arxml::project::ModelProject::openModelFromProject(project, parser);
+            auto model = parser.getModel();
+            auto trie = arxml::helpers::PathTrie::build(*model);
+            for (const auto& prefix: prefixes) {
+                std::vector<arxml::helpers::PathTrie::Completion> result;
+                {
+                    ARXML_TRACE_SCOPE("finder complete", prefix);
+                    result = trie.complete(prefix);
+                }
+                std::cout << "Found following completions of " << prefix << ":\n";
+                if (result.empty()) {
+                    std::cout << "none\n";
+                }
+                for (const auto& completion: result) {
+                    const auto& node = trie[completion.node];
+                    std::cout << completion.path << (node.children > 0 ? "/" : "") << " ("
+                              << (node.tag.empty() ? "package" : node.tag.view()) << ")\n";
+                }
+            }
+        }
     }
 
     void FinderSubProgram::execute(const std::vector<std::string>& args) {
@@ -104,19 +280,50 @@ namespace arxml_tool {
         else if (mode == "by_ref") {
             find_by_ref(path, name);
         }
+        else if (mode == "query") {
+            find_by_query(path, std::vector<std::string>(args.begin() + 4, args.end()));
+        }
+        else if (mode == "text") {
+            find_by_text(path, std::vector<std::string>(args.begin() + 4, args.end()));
+        }
+        else if (mode == "merged") {
+            show_merged(path, std::vector<std::string>(args.begin() + 4, args.end()));
+        }
+        else if (mode == "complete") {
+            complete_paths(path, std::vector<std::string>(args.begin() + 4, args.end()));
+        }
+        else if (mode == "duplicates") {
+            find_duplicates(path, name);
+        }
     }
 
     std::string FinderSubProgram::help() {
         std::stringstream ss;
-        ss << "ARXML Tool Finder supports three modes:\n";
+        ss << "ARXML Tool Finder supports eight modes:\n";
         ss << "by_tag - lists all elements defined under given tag\n"
            << "by_ref - shows elements with references to the given object\n"
-           << "by_id - shows element with given id\n\n"
+           << "by_id - shows element with given id\n"
+           << "query - lists elements matching the path query; a step is a short name or tag, * matches one\n"
+           << "        level, ** any number of levels, [PATH] and [PATH='value'] filter on the content;\n"
+           << "        many queries are evaluated in a single pass over the model\n"
+           << "text - lists text values and short names containing the pattern; the model is indexed once,\n"
+           << "        so many patterns are cheap\n"
+           << "merged - shows files defining the path and its children, with packages of all files merged\n"
+           << "duplicates - lists element paths under the prefix defined more than once, as identical or\n"
+           << "        conflicting copies\n"
+           << "complete - lists children of the last path segment's parent starting with that segment, a prefix\n"
+           << "        ending with a slash lists all children\n\n"
            << "Command need to be called on the following ways\n";
         ss  << "1 | help\n"
-            << "2 | dir MODEL_DIR_NAME [by_tag|by_id] NAME\n"
-            << "3 | config CONFIGURATION_FILE_NAME [by_tag|by_id|by_ref] NAME\n\n";
+            << "2 | dir MODEL_DIR_NAME [by_tag|by_id|by_ref] NAME\n"
+            << "3 | dir MODEL_DIR_NAME [query|text|merged|complete] PATTERN [PATTERN...]\n"
+            << "4 | dir MODEL_DIR_NAME duplicates PREFIX\n"
+            << "5 | config CONFIGURATION_FILE_NAME [by_tag|by_id|by_ref|query|text|merged|duplicates|complete] NAME\n\n";
         ss << "Examples:\n./arxml_tool finder dir data/ by_tag SERVICE-INTERFACE\n";
+        ss << "./arxml_tool finder dir data/ query '/apd/**/SERVICE-INTERFACE[EVENTS/VARIABLE-DATA-PROTOTYPE]/SHORT-NAME'\n";
+        ss << "./arxml_tool finder dir data/ text Float Service\n";
+        ss << "./arxml_tool finder dir data/ duplicates /\n";
+        ss << "./arxml_tool finder dir data/ complete /apd/Serv\n";
         ss << "./arxml-tool finder config config.yml by_id /apd/ServiceInterfaces/TestService";
         return ss.str();
     }
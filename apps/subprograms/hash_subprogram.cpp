@@ -0,0 +1,105 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "hash_subprogram.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <arxml/utilities/parser_facade.hpp>
+#include <arxml/dfs/callbacks.hpp>
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    namespace {
+        class HashPrinterCallback : public arxml::dfs::TraversalCallback {
+        public:
+            explicit HashPrinterCallback(std::vector<std::string> prefixes)
+            : m_prefixes{std::move(prefixes)}
+            {
+
+            }
+
+            arxml::dfs::VisitResult visit(const arxml::model::IAutosarPackage& package) override {
+                m_path.push_back(m_path.back() + "/" + package.getName());
+                print(package.getContentHash());
+                return arxml::dfs::VisitResult::CONTINUE;
+            }
+
+            void close(const arxml::model::IAutosarPackage& package) override { m_path.pop_back(); }
+
+            arxml::dfs::VisitResult visit(const arxml::model::IAutosarElement& element) override {
+                if (element.getType() == arxml::model::EntryType::NAMED_ELEMENT) {
+                    auto& named = dynamic_cast<const arxml::model::INamedAutosarElement&>(element);
+                    m_path.push_back(m_path.back() + "/" + named.getName());
+                    print(named.getContentHash());
+                }
+                return arxml::dfs::VisitResult::CONTINUE;
+            }
+
+            void close(const arxml::model::IAutosarElement& element) override {
+                if (element.getType() == arxml::model::EntryType::NAMED_ELEMENT) {
+                    m_path.pop_back();
+                }
+            }
+        private:
+            void print(std::uint64_t hash) {
+                const auto& path = m_path.back();
+                bool selected = m_prefixes.empty() or std::any_of(m_prefixes.begin(), m_prefixes.end(),
+                                                                  [&](const std::string& prefix) {
+                    return path == prefix or path.starts_with(prefix + "/");
+                });
+                if (selected) {
+                    std::cout << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec
+                              << "  " << path << "\n";
+                }
+            }
+
+            std::vector<std::string> m_prefixes;
+            std::vector<std::string> m_path{""};
+        };
+    }
+
+    void HashSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() < 3) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode and path or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        std::string path = args[2];
+        arxml::utilities::DefaultParserFacade parser;
+        parser.enableContentHashing();
+        auto project = ProjectOptions::instance().createProject();
+        project.addDirectory(path);
+        arxml::project::ModelProject::openModelFromProject(project, parser);
+        auto model = parser.getModel();
+        HashPrinterCallback callback(std::vector<std::string>(args.begin() + 3, args.end()));
+        arxml::dfs::traverse_model(*model, callback);
+    }
+
+    std::string HashSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Hash prints 64-bit content hashes of packages and named elements.\n"
+           << "Hash of the element covers its tag, name, values, attributes and all children, so equal hashes "
+           << "mean unchanged subtrees.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir MODEL_DIR_NAME [PATH...]\n\n";
+        ss << "Examples:\n./arxml_tool hash dir data/\n";
+        ss << "./arxml_tool hash dir data/ /apd/ServiceInterfaces";
+        return ss.str();
+    }
+
+}
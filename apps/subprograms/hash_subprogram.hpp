@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class HashSubProgram : public AbstractSubProgram {
+    public:
+        HashSubProgram()
+                : AbstractSubProgram("hash") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "print content hashes of packages and named elements"; }
+        std::string help() override;
+    };
+
+}
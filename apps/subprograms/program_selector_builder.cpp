@@ -7,6 +7,12 @@
 #include "structure_dump_subprogram.hpp"
 #include "dump_tree_subprogram.hpp"
 #include "finder_subprogram.hpp"
+#include "slice_subprogram.hpp"
+#include "diff_subprogram.hpp"
+#include "hash_subprogram.hpp"
+#include "export_subprogram.hpp"
+#include "validate_subprogram.hpp"
+#include "stats_subprogram.hpp"
 
 namespace arxml_tool {
 
@@ -14,6 +20,12 @@ namespace arxml_tool {
         m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new DumpTreeSubprogram));
         m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new FinderSubProgram));
         m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new StructureDumpSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new SliceSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new DiffSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new HashSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new ExportSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new ValidateSubProgram));
+        m_selector.registerSubProgram(std::unique_ptr<AbstractSubProgram>(new StatsSubProgram));
     }
 
 }
@@ -0,0 +1,79 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "slice_subprogram.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <arxml/utilities/input_source.hpp>
+#include <arxml/utilities/parser_facade.hpp>
+#include <arxml/helpers/slicer.hpp>
+#include <arxml/printer.hpp>
+#include <arxml/project.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    void SliceSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() < 5) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode, path, output directory and root "
+                                   "elements or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        std::filesystem::path path = args[2];
+        std::filesystem::path output = args[3];
+        std::vector<std::string> roots(args.begin() + 4, args.end());
+
+        arxml::utilities::DefaultParserFacade parser;
+        auto project = ProjectOptions::instance().createProject();
+        project.addDirectory(path.string());
+        arxml::project::ModelProject::openModelFromProject(project, parser);
+        auto model = parser.getModel();
+
+        arxml::utilities::parser::ModelComponentFactory factory;
+        arxml::helpers::ModelSlicer slicer(*model);
+        auto sliced = slicer.slice(roots, factory);
+        if (sliced->getModelUnits().empty()) {
+            std::cout << "None of the root elements was found in the model\n";
+            return;
+        }
+
+        for (auto& [entry_name, entry]: sliced->getModelUnits()) {
+            // Sliced model is always written uncompressed
+            auto destination = output / std::filesystem::relative(arxml::utilities::io::uncompressed_name(entry_name), path);
+            std::filesystem::create_directories(destination.parent_path());
+            std::ofstream stream(destination);
+            if (not stream) {
+                throw std::runtime_error("Cannot write sliced model to " + destination.string());
+            }
+            arxml::printer::ArxmlPrinter printer(stream);
+            printer.print(*entry);
+            std::cout << "Written " << destination.string() << std::endl;
+        }
+    }
+
+    std::string SliceSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Slice writes only the part of the model reachable from the given root elements.\n"
+           << "Root may be a path to the element or to the package. Referenced elements are followed "
+           << "transitively and written to the output directory with the same file layout.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir MODEL_DIR_NAME OUTPUT_DIR ROOT_PATH [ROOT_PATH...]\n"
+            << "3 | config CONFIGURATION_FILE_NAME OUTPUT_DIR ROOT_PATH [ROOT_PATH...]\n\n";
+        ss << "Example:\n./arxml_tool slice dir data/ sliced/ /machines/Ecu1";
+        return ss.str();
+    }
+
+}
@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class SliceSubProgram : public AbstractSubProgram {
+    public:
+        SliceSubProgram()
+                : AbstractSubProgram("slice") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "extract part of the model reachable from given elements"; }
+        std::string help() override;
+    };
+
+}
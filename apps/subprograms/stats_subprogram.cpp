@@ -0,0 +1,93 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "stats_subprogram.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <arxml/helpers/model_stats.hpp>
+#include <arxml/project.hpp>
+#include <arxml/utilities/parser_facade.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    namespace {
+        const char* TYPE_NAMES[] = {"AUTOSAR", "PACKAGES", "PACKAGE", "ELEMENTS", "GENERIC_ELEMENT",
+                                    "COMPOSITE_ELEMENT", "NAMED_ELEMENT", "INTEGER_ELEMENT", "FLOATING_ELEMENT",
+                                    "STRING_ELEMENT", "REFERENCE_ELEMENT"};
+        static_assert(std::size(TYPE_NAMES) == arxml::helpers::ModelStats::ENTRY_TYPES);
+
+        void printFootprint(const arxml::helpers::ModelStats::Footprint& footprint) {
+            std::cout << "  " << std::setw(12) << footprint.node_bytes << "  node objects\n"
+                      << "  " << std::setw(12) << footprint.string_bytes << "  strings\n"
+                      << "  " << std::setw(12) << footprint.attribute_bytes << "  attributes\n"
+                      << "  " << std::setw(12) << footprint.vector_bytes << "  vectors\n";
+        }
+    }
+
+    void StatsSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() != 3) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode and path or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        std::string path = args[2];
+        arxml::utilities::DefaultParserFacade parser;
+        auto project = ProjectOptions::instance().createProject();
+        project.addDirectory(path);
+        arxml::project::ModelProject::openModelFromProject(project, parser);
+        auto model = parser.getModel();
+        auto stats = arxml::helpers::ModelStats::collect(*model);
+
+        const auto& total = stats.total();
+        std::cout << "Model: " << total.nodes << " nodes, " << total.bytes() << " bytes\n";
+        printFootprint(total);
+        std::cout << "Symbols: " << stats.symbols() << " interned, " << stats.symbolBytes() << " bytes\n";
+
+        std::cout << "\nNodes by type:\n";
+        for (std::size_t type = 0; type < arxml::helpers::ModelStats::ENTRY_TYPES; ++type) {
+            if (auto count = stats.count(static_cast<arxml::model::EntryType>(type))) {
+                std::cout << "  " << std::setw(12) << count << "  " << TYPE_NAMES[type] << "\n";
+            }
+        }
+
+        std::cout << "\nElements by tag:\n";
+        for (const auto& [tag, count]: stats.getTags()) {
+            std::cout << "  " << std::setw(12) << count << "  " << tag.view() << "\n";
+        }
+
+        auto files = stats.getFiles();
+        std::stable_sort(files.begin(), files.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.footprint.bytes() > rhs.footprint.bytes();
+        });
+        std::cout << "\nFiles, largest first:\n";
+        for (const auto& [file, footprint]: files) {
+            std::cout << "  " << std::setw(12) << footprint.bytes() << "  " << std::setw(10) << footprint.nodes
+                      << " nodes  " << file << "\n";
+        }
+    }
+
+    std::string StatsSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Stats loads the model and reports how much memory its parts take: nodes by type, "
+           << "elements by tag, bytes of node objects, strings, attributes and vectors, and the footprint of "
+           << "every file.\nInterned names, tags and attribute values are shared by all files and reported once.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir MODEL_DIR_NAME\n\n";
+        ss << "Examples:\n./arxml_tool stats dir data/";
+        return ss.str();
+    }
+
+}
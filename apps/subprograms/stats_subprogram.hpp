@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class StatsSubProgram : public AbstractSubProgram {
+    public:
+        StatsSubProgram()
+                : AbstractSubProgram("stats") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "report node counts and memory taken by the loaded model"; }
+        std::string help() override;
+    };
+
+}
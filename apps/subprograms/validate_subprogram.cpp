@@ -0,0 +1,54 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include "validate_subprogram.hpp"
+
+#include <iostream>
+#include <sstream>
+
+#include <arxml/project.hpp>
+#include <arxml/utilities/diagnostics.hpp>
+#include <arxml/utilities/validator.hpp>
+#include <arxml_tool/project_options.hpp>
+
+namespace arxml_tool {
+
+    void ValidateSubProgram::execute(const std::vector<std::string>& args) {
+        if (args[0] != getName()) {
+            return;
+        }
+        if (args.size() == 1 or (args.size() > 1 and args[1] == "help")) {
+            std::cerr << help() << std::endl;
+            return;
+        }
+        if (args.size() != 3) {
+            throw std::logic_error("Invalid number of the arguments! Expected mode and path or ask for the help.");
+        }
+        std::string project_configuration = args[1];
+        std::string path = args[2];
+        auto project = ProjectOptions::instance().createProject();
+        project.addDirectory(path);
+
+        arxml::utilities::StructureValidator validator(arxml::utilities::Diagnostics::instance());
+        arxml::project::ModelProject::forEachFile(project, [&validator](const std::string& file) {
+            ARXML_TRACE_SCOPE("validate", file);
+            validator.validateFile(file);
+        });
+        validator.finish();
+        std::cout << "Validated " << validator.files() << " files, " << validator.paths() << " paths" << std::endl;
+    }
+
+    std::string ValidateSubProgram::help() {
+        std::stringstream ss;
+        ss << "ARXML Tool Validate checks files without building the model: AUTOSAR root with a single AR-PACKAGES, "
+           << "SHORT-NAME of every package and element, unique paths of elements and targets of all absolute "
+           << "references.\nFiles are streamed and checked in parallel, problems are reported with file and line.\n\n"
+           << "Command need to be called on the following ways\n";
+        ss  << "1 | help\n"
+            << "2 | dir MODEL_DIR_NAME\n\n";
+        ss << "Examples:\n./arxml_tool validate dir data/";
+        return ss.str();
+    }
+
+}
@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <arxml_tool/subprograms.hpp>
+
+namespace arxml_tool {
+
+    class ValidateSubProgram : public AbstractSubProgram {
+    public:
+        ValidateSubProgram()
+                : AbstractSubProgram("validate") {
+
+        }
+
+        void execute(const std::vector<std::string>& args) override;
+        std::string description() override { return "check structure, unique paths and references without loading the model"; }
+        std::string help() override;
+    };
+
+}
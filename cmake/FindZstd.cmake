@@ -0,0 +1,30 @@
+# - Try to find the zstd compression library
+# Once done this will define
+#
+#  ZSTD_FOUND - system has zstd
+#  ZSTD_INCLUDE_DIR - the zstd include directory
+#  ZSTD_LIBRARIES - the zstd library
+
+FIND_PATH(ZSTD_INCLUDE_DIR zstd.h
+        /usr/include
+        /usr/local/include
+)
+
+FIND_LIBRARY(ZSTD_LIBRARIES NAMES zstd PATHS
+        /usr/lib/
+        /usr/local/lib
+        /usr/lib/x86_64-linux-gnu/
+)
+
+SET(ZSTD_FOUND FALSE)
+IF (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARIES)
+    SET(ZSTD_FOUND TRUE)
+ENDIF (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARIES)
+
+if(ZSTD_FOUND)
+    message(STATUS "Found zstd: ${ZSTD_LIBRARIES}")
+else(ZSTD_FOUND)
+    message(STATUS "Could NOT find zstd, reading .arxml.zst files is disabled")
+endif(ZSTD_FOUND)
+
+MARK_AS_ADVANCED(ZSTD_INCLUDE_DIR ZSTD_LIBRARIES)
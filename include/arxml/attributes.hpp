@@ -0,0 +1,109 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arxml/utilities/symbols.hpp>
+
+namespace arxml::model {
+
+    struct AttributeView {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    // Attributes of a simple element. Leaves usually carry no attribute or a single DEST, so the first
+    // attribute is stored inline and only further ones are allocated. Names are interned, values are not:
+    // they are an open set and interned strings are never released.
+    class AttributeList {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = AttributeView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = AttributeView;
+
+            Iterator() = default;
+            Iterator(const AttributeList* list, std::size_t index) : m_list{list}, m_index{index} {}
+
+            AttributeView operator*() const { return (*m_list)[m_index]; }
+            Iterator& operator++() { ++m_index; return *this; }
+            Iterator operator++(int) { auto copy = *this; ++m_index; return copy; }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+        private:
+            const AttributeList* m_list = nullptr;
+            std::size_t m_index = 0;
+        };
+
+        void add(std::string_view name, std::string_view value) {
+            Attribute attribute{utilities::intern(name), std::string(value)};
+            if (m_first.name.empty()) {
+                m_first = std::move(attribute);
+                return;
+            }
+            if (not m_rest) {
+                m_rest = std::make_unique<std::vector<Attribute>>();
+            }
+            m_rest->push_back(std::move(attribute));
+        }
+
+        [[nodiscard]] std::optional<std::string_view> find(std::string_view name) const noexcept {
+            for (auto attribute: *this) {
+                if (attribute.name == name) {
+                    return attribute.value;
+                }
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_first.name.empty() ? 0 : 1 + (m_rest ? m_rest->size() : 0);
+        }
+        [[nodiscard]] bool empty() const noexcept { return m_first.name.empty(); }
+        // Heap memory of attributes beyond the first and of values which do not fit into their string
+        [[nodiscard]] std::size_t bytes() const noexcept {
+            auto result = heapBytes(m_first.value);
+            if (m_rest) {
+                result += sizeof(*m_rest) + m_rest->capacity() * sizeof(Attribute);
+                for (const auto& attribute: *m_rest) {
+                    result += heapBytes(attribute.value);
+                }
+            }
+            return result;
+        }
+
+        AttributeView operator[](std::size_t index) const {
+            const auto& attribute = index == 0 ? m_first : (*m_rest)[index - 1];
+            return {attribute.name.view(), attribute.value};
+        }
+
+        [[nodiscard]] Iterator begin() const { return {this, 0}; }
+        [[nodiscard]] Iterator end() const { return {this, size()}; }
+    private:
+        struct Attribute {
+            utilities::Symbol name;
+            std::string value;
+        };
+
+        static std::size_t heapBytes(const std::string& value) noexcept {
+            auto inside = value.data() >= reinterpret_cast<const char*>(&value)
+                          and value.data() < reinterpret_cast<const char*>(&value + 1);
+            return inside ? 0 : value.capacity() + 1;
+        }
+
+        Attribute m_first;
+        std::unique_ptr<std::vector<Attribute>> m_rest;
+    };
+
+}
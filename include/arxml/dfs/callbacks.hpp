@@ -8,22 +8,29 @@
 
 namespace arxml::dfs {
 
+    enum class VisitResult {
+        CONTINUE,       // descend into the children
+        SKIP_CHILDREN,  // do not descend, the node is still closed
+        STOP            // end the traversal, no further visits or closes are delivered
+    };
+
+    // Callbacks observe the model read-only, so a traversal may run concurrently with other readers
     class TraversalCallback {
     public:
         virtual ~TraversalCallback() = default;
-        virtual void visit(model::IAutosarModel& root) {}
-        virtual void visit(model::IModelEntry& root) {}
-        virtual void visit(model::IAutosarPackages& packages) {}
-        virtual void visit(model::IAutosarPackage& package) {}
-        virtual void visit(model::IAutosarElements& elements) {}
-        virtual void visit(model::IAutosarElement& element) {}
+        virtual VisitResult visit(const model::IAutosarModel& root) { return VisitResult::CONTINUE; }
+        virtual VisitResult visit(const model::IModelEntry& root) { return VisitResult::CONTINUE; }
+        virtual VisitResult visit(const model::IAutosarPackages& packages) { return VisitResult::CONTINUE; }
+        virtual VisitResult visit(const model::IAutosarPackage& package) { return VisitResult::CONTINUE; }
+        virtual VisitResult visit(const model::IAutosarElements& elements) { return VisitResult::CONTINUE; }
+        virtual VisitResult visit(const model::IAutosarElement& element) { return VisitResult::CONTINUE; }
 
-        virtual void close(model::IAutosarModel& root) {}
-        virtual void close(model::IModelEntry& root) {}
-        virtual void close(model::IAutosarPackages& packages) {}
-        virtual void close(model::IAutosarPackage& package) {}
-        virtual void close(model::IAutosarElements& elements) {}
-        virtual void close(model::IAutosarElement& element) {}
+        virtual void close(const model::IAutosarModel& root) {}
+        virtual void close(const model::IModelEntry& root) {}
+        virtual void close(const model::IAutosarPackages& packages) {}
+        virtual void close(const model::IAutosarPackage& package) {}
+        virtual void close(const model::IAutosarElements& elements) {}
+        virtual void close(const model::IAutosarElement& element) {}
     };
 
 }
@@ -0,0 +1,53 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <arxml/dfs/callbacks.hpp>
+
+namespace arxml::dfs {
+
+    // Drives many callbacks from a single traversal. A callback skipping children of a node is muted until
+    // the node is closed and a stopped callback receives nothing more; the traversal itself skips children
+    // only when no callback wants them and stops when every callback stopped.
+    class TraversalMultiplexer : public TraversalCallback {
+    public:
+        void addCallback(TraversalCallback& callback);
+        [[nodiscard]] std::size_t size() const noexcept { return m_callbacks.size(); }
+
+        VisitResult visit(const model::IAutosarModel& root) override;
+        VisitResult visit(const model::IModelEntry& root) override;
+        VisitResult visit(const model::IAutosarPackages& packages) override;
+        VisitResult visit(const model::IAutosarPackage& package) override;
+        VisitResult visit(const model::IAutosarElements& elements) override;
+        VisitResult visit(const model::IAutosarElement& element) override;
+
+        void close(const model::IAutosarModel& root) override;
+        void close(const model::IModelEntry& root) override;
+        void close(const model::IAutosarPackages& packages) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElements& elements) override;
+        void close(const model::IAutosarElement& element) override;
+    private:
+        static constexpr std::size_t ACTIVE = 0;
+        static constexpr std::size_t STOPPED = std::numeric_limits<std::size_t>::max();
+
+        struct Entry {
+            TraversalCallback* callback;
+            std::size_t muted_depth;    // depth of the node whose children are skipped, ACTIVE or STOPPED
+        };
+
+        template<class Node>
+        VisitResult forwardVisit(const Node& node);
+        template<class Node>
+        void forwardClose(const Node& node);
+
+        std::vector<Entry> m_callbacks;
+        std::size_t m_depth = 0;
+    };
+
+}
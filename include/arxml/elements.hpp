@@ -4,12 +4,18 @@
 
 #pragma once
 
+#include <cstdint>
+#include <iterator>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 #include <memory>
 #include <map>
 
+#include <arxml/attributes.hpp>
+
 namespace arxml::model {
 
     enum class EntryType {
@@ -22,7 +28,8 @@ namespace arxml::model {
         NAMED_ELEMENT,
         INTEGER_ELEMENT,
         FLOATING_ELEMENT,
-        STRING_ELEMENT
+        STRING_ELEMENT,
+        REFERENCE_ELEMENT
     };
 
     enum class CollectionType {
@@ -40,8 +47,54 @@ namespace arxml::model {
     class ISimpleAutosarElement;
     class ICompositeAutosarElement;
     class IStringAutosarElement;
+    class IReferenceAutosarElement;
     class INumberAutosarElement;
 
+    // Read-only view of a container of owning pointers (or of a map to them). Pointed objects are exposed
+    // as const references, so a const model cannot be modified through its children.
+    template<class Element, class Container = std::vector<std::unique_ptr<Element>>>
+    class ConstPointerRange {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Element;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Element*;
+            using reference = const Element&;
+
+            Iterator() = default;
+            explicit Iterator(typename Container::const_iterator it) : m_it{it} {}
+
+            reference operator*() const { return project(*m_it); }
+            pointer operator->() const { return &project(*m_it); }
+            Iterator& operator++() { ++m_it; return *this; }
+            Iterator operator++(int) { auto copy = *this; ++m_it; return copy; }
+            bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+            bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+        private:
+            typename Container::const_iterator m_it;
+        };
+
+        explicit ConstPointerRange(const Container& container) : m_container{&container} {}
+
+        [[nodiscard]] Iterator begin() const { return Iterator(m_container->begin()); }
+        [[nodiscard]] Iterator end() const { return Iterator(m_container->end()); }
+        [[nodiscard]] std::size_t size() const noexcept { return m_container->size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_container->empty(); }
+        // Vectors only, reserved slots included
+        [[nodiscard]] std::size_t capacity() const noexcept { return m_container->capacity(); }
+        [[nodiscard]] const Element& operator[](std::size_t index) const { return project((*m_container)[index]); }
+    private:
+        static const Element& project(const std::unique_ptr<Element>& pointer) { return *pointer; }
+        template<class Key>
+        static const Element& project(const std::pair<const Key, std::unique_ptr<Element>>& entry) {
+            return *entry.second;
+        }
+
+        const Container* m_container;
+    };
+
     class IAutosarModelObject {
     public:
         virtual ~IAutosarModelObject() = default;
@@ -54,8 +107,10 @@ namespace arxml::model {
 
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::AUTOSAR; }
         virtual IModelEntry& getModelEntry(const std::string& entry_name) = 0;
+        [[nodiscard]] virtual const IModelEntry& getModelEntry(const std::string& entry_name) const = 0;
         virtual void registerModelEntry(const std::string& entry_name, std::unique_ptr<IModelEntry> package) = 0;
         [[nodiscard]] virtual ModelUnitMap& getModelUnits() noexcept = 0;
+        [[nodiscard]] virtual ConstPointerRange<IModelEntry, ModelUnitMap> getModelUnits() const noexcept = 0;
     };
 
     class IAutosarPackages : public IAutosarModelObject {
@@ -66,12 +121,13 @@ namespace arxml::model {
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::PACKAGES; }
 
         virtual PackagePtrContainer& getPackages() noexcept = 0;
+        [[nodiscard]] virtual ConstPointerRange<IAutosarPackage> getPackages() const noexcept = 0;
         virtual void addPackage(PackagePtr package) noexcept = 0;
     };
 
     class IModelEntry : public IAutosarPackages {
     public:
-        virtual std::string getEntryName() = 0;
+        [[nodiscard]] virtual std::string getEntryName() const = 0;
         [[nodiscard]] virtual const std::string& getXmlns() const noexcept = 0;
         [[nodiscard]] virtual const std::string& getXmlnsXsi() const noexcept = 0;
         [[nodiscard]] virtual const std::string& getSchemaLocation() const noexcept = 0;
@@ -80,45 +136,58 @@ namespace arxml::model {
     class IAutosarPackage : public IAutosarModelObject {
     public:
         [[nodiscard]] virtual const std::string& getName() const noexcept = 0;
+        [[nodiscard]] virtual utilities::Symbol getNameId() const noexcept = 0;
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::PACKAGE; }
         [[nodiscard]] virtual CollectionType getCollectionType() const noexcept = 0;
         [[nodiscard]] virtual IAutosarElements& getElements() = 0;
+        [[nodiscard]] virtual const IAutosarElements& getElements() const = 0;
         [[nodiscard]] virtual IAutosarPackages& getPackages() = 0;
+        [[nodiscard]] virtual const IAutosarPackages& getPackages() const = 0;
+        [[nodiscard]] virtual std::uint64_t getContentHash() const noexcept = 0;
+        virtual void setContentHash(std::uint64_t hash) noexcept = 0;
     };
 
     class IAutosarElements : public IAutosarModelObject {
     public:
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::ELEMENTS; }
         virtual std::vector<std::unique_ptr<INamedAutosarElement>>& getElements() noexcept = 0;
+        [[nodiscard]] virtual ConstPointerRange<INamedAutosarElement> getElements() const noexcept = 0;
         virtual void addElement(std::unique_ptr<INamedAutosarElement> element) noexcept = 0;
     };
 
     class IAutosarElement : public IAutosarModelObject {
     public:
         [[nodiscard]] virtual std::string getTag() const noexcept = 0;
+        [[nodiscard]] virtual utilities::Symbol getTagId() const noexcept = 0;
         [[nodiscard]] virtual bool isComposite() const noexcept { return false; }
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::GENERIC_ELEMENT; }
     };
 
     class ISimpleAutosarElement : public IAutosarElement {
     public:
-        using AttributePair = std::pair<std::string, std::string>;
-
-        virtual void addAttribute(std::string name, std::string value) noexcept = 0;
-        virtual std::optional<std::string> getAttribute(std::string_view name) = 0;
-        virtual const std::vector<AttributePair>& getAttributes() const noexcept = 0;
+        virtual void addAttribute(std::string_view name, std::string_view value) = 0;
+        [[nodiscard]] virtual std::optional<std::string_view> getAttribute(std::string_view name) const noexcept = 0;
+        [[nodiscard]] virtual const AttributeList& getAttributes() const noexcept = 0;
     };
 
     class INumberAutosarElement : public ISimpleAutosarElement {
     public:
-        virtual int getInteger() = 0;
-        virtual double getFloating() = 0;
+        [[nodiscard]] virtual int getInteger() const = 0;
+        [[nodiscard]] virtual double getFloating() const = 0;
     };
 
     class IStringAutosarElement : public ISimpleAutosarElement {
     public:
-        virtual const std::string& getText() = 0;
+        [[nodiscard]] virtual const std::string& getText() const = 0;
+
+    };
 
+    // String element carrying a DEST attribute. Destination kind and target path segments are interned
+    // while parsing, so references are recognised by type and compared by symbol instead of by text.
+    class IReferenceAutosarElement : public IStringAutosarElement {
+    public:
+        [[nodiscard]] virtual utilities::Symbol getDestination() const noexcept = 0;
+        [[nodiscard]] virtual const std::vector<utilities::Symbol>& getTargetSegments() const noexcept = 0;
     };
 
     class ICompositeAutosarElement : public IAutosarElement {
@@ -126,12 +195,16 @@ namespace arxml::model {
         virtual void addSubElement(std::unique_ptr<IAutosarElement> element) noexcept = 0;
         [[nodiscard]] EntryType getType() const noexcept override { return EntryType::COMPOSITE_ELEMENT; }
         virtual std::vector<std::unique_ptr<IAutosarElement>>& getSubElements() noexcept = 0;
+        [[nodiscard]] virtual ConstPointerRange<IAutosarElement> getSubElements() const noexcept = 0;
         [[nodiscard]] bool isComposite() const noexcept override { return true; }
     };
 
     class INamedAutosarElement : public ICompositeAutosarElement {
     public:
         [[nodiscard]] virtual std::string getName() const noexcept = 0;
+        [[nodiscard]] virtual utilities::Symbol getNameId() const noexcept = 0;
         EntryType getType() const noexcept override { return EntryType::NAMED_ELEMENT; }
+        [[nodiscard]] virtual std::uint64_t getContentHash() const noexcept = 0;
+        virtual void setContentHash(std::uint64_t hash) noexcept = 0;
     };
 }
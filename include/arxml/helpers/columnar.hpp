@@ -0,0 +1,65 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    // Column of strings kept in Arrow layout: values are concatenated and delimited by offsets
+    class StringColumn {
+    public:
+        explicit StringColumn(std::string name);
+
+        void append(std::string_view value);
+
+        [[nodiscard]] const std::string& getName() const noexcept { return m_name; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_offsets.size() - 1; }
+        [[nodiscard]] std::string_view operator[](std::size_t index) const noexcept {
+            return std::string_view(m_data).substr(m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+        }
+        [[nodiscard]] const std::string& getData() const noexcept { return m_data; }
+        [[nodiscard]] const std::vector<std::int32_t>& getOffsets() const noexcept { return m_offsets; }
+    private:
+        std::string m_name;
+        std::string m_data;
+        std::vector<std::int32_t> m_offsets;
+    };
+
+    class Table {
+    public:
+        explicit Table(std::initializer_list<std::string> column_names);
+
+        void addRow(std::initializer_list<std::string_view> values);
+
+        [[nodiscard]] std::size_t rows() const noexcept { return m_columns.front().size(); }
+        [[nodiscard]] const std::vector<StringColumn>& getColumns() const noexcept { return m_columns; }
+    private:
+        std::vector<StringColumn> m_columns;
+    };
+
+    struct ModelTables {
+        Table elements;     // path, tag, parent, file of every named element
+        Table references;   // source, dest, target of every reference
+    };
+
+    // Both tables are filled during a single traversal of the model
+    ModelTables tabulate_model(const model::IAutosarModel& model);
+
+    // RFC 4180 CSV with a header row
+    void write_csv(std::ostream& os, const Table& table);
+
+    // Arrow IPC stream (schema, single record batch, end of stream marker) of non-nullable utf8 columns,
+    // readable e.g. with pyarrow.ipc.open_stream
+    void write_arrow_ipc(std::ostream& os, const Table& table);
+
+}
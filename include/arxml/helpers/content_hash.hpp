@@ -0,0 +1,28 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    // Merkle-style structural hashes. A hash covers the tag, the short name, simple values, attributes and the
+    // hashes of all children in order. Packages and named elements store their hash; annotation works bottom-up,
+    // so a parent reuses the stored hashes of its named children.
+    std::uint64_t annotate_content_hashes(model::IAutosarModel& model);
+    std::uint64_t annotate_content_hashes(model::IModelEntry& entry);
+    std::uint64_t annotate_content_hashes(model::IAutosarPackage& package);
+    std::uint64_t annotate_content_hashes(model::IAutosarElement& element);
+
+    // Hash of an already annotated subtree. Named descendants are not visited, their stored hash is used.
+    std::uint64_t content_hash(const model::IAutosarElement& element);
+
+    std::uint64_t hash_string(std::string_view value);
+    std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value);
+
+}
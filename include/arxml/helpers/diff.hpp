@@ -0,0 +1,56 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arxml/elements.hpp>
+#include <arxml/project.hpp>
+
+namespace arxml::helpers {
+
+    enum class DifferenceKind {
+        ADDED,
+        REMOVED,
+        CHANGED
+    };
+
+    struct ModelDifference {
+        DifferenceKind kind;
+        std::string path;
+        std::string description;
+    };
+
+    // Semantic comparison of two models. Top level elements are matched by their fully qualified path,
+    // nested elements by short name (named elements) or by tag and position. When both models are annotated
+    // with content hashes, subtrees with equal hashes are not descended into; otherwise they are compared in full.
+    class ModelComparator {
+    public:
+        ModelComparator(const model::IAutosarModel& lhs, const model::IAutosarModel& rhs);
+
+        std::vector<ModelDifference> compare();
+
+        static std::vector<ModelDifference> compare(const project::ModelProject& lhs, const project::ModelProject& rhs);
+    private:
+        using PathIndex = std::unordered_map<std::string, const model::INamedAutosarElement*>;
+
+        void compareElements(const std::string& path, const model::IAutosarElement& lhs,
+                             const model::IAutosarElement& rhs);
+        void compareSubElements(const std::string& path, const model::ICompositeAutosarElement& lhs,
+                                const model::ICompositeAutosarElement& rhs);
+        void compareValues(const std::string& path, const model::ISimpleAutosarElement& lhs,
+                           const model::ISimpleAutosarElement& rhs);
+
+        const model::IAutosarModel& m_lhs;
+        const model::IAutosarModel& m_rhs;
+        PathIndex m_lhs_index;
+        PathIndex m_rhs_index;
+        bool m_hashed;      // every top level element of both models has its content hash
+        std::vector<ModelDifference> m_result;
+    };
+
+}
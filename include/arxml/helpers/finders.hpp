@@ -5,78 +5,76 @@
 #pragma once
 
 #include <arxml/dfs/callbacks.hpp>
+#include <arxml/utilities/symbols.hpp>
 
 #include <vector>
 
 namespace arxml::helpers {
 
+    // Expected ids and references are resolved against the symbol table on construction, so those finders have
+    // to be created once the searched model is loaded. Tags are interned, a tag finder can be created up front.
     class ElementByTagFinder : public dfs::TraversalCallback {
     public:
-        ElementByTagFinder(std::map<std::string, model::INamedAutosarElement&>& result, std::string expected_tag)
-                : m_result{result}
-                , m_expected_tag{std::move(expected_tag)}
+        ElementByTagFinder(std::map<std::string, const model::INamedAutosarElement&>& result, std::string expected_tag)
+                : m_expected_tag{utilities::intern(expected_tag)}
+                , m_result{result}
         {
 
         }
 
-        void visit(model::IAutosarElements& elements) override;
-        void visit(model::IAutosarPackage& package) override;
-        void close(model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarPackage& package) override;
     private:
-        std::string m_expected_tag;
-        std::map<std::string, model::INamedAutosarElement&>& m_result;
-        std::vector<std::string> m_path;
+        utilities::Symbol m_expected_tag;
+        std::map<std::string, const model::INamedAutosarElement&>& m_result;
+        utilities::SymbolPath m_path;
     };
 
     class ElementByIdFinder : public dfs::TraversalCallback {
     public:
-        ElementByIdFinder(std::vector<std::reference_wrapper<model::INamedAutosarElement>>& result, std::string expected_id)
-                : m_result{result}
-                , m_expected_id{std::move(expected_id)}
-        {
-
-        }
+        ElementByIdFinder(std::vector<std::reference_wrapper<const model::INamedAutosarElement>>& result, std::string expected_id);
 
-        void visit(model::IAutosarElement& element) override;
-        void visit(model::IAutosarPackage& package) override;
-        void close(model::IAutosarPackage& package) override;
-        void close(model::IAutosarElement& package) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElement& package) override;
     private:
-        std::string m_expected_id;
-        std::vector<std::reference_wrapper<model::INamedAutosarElement>>& m_result;
-        std::vector<std::string> m_path;
+        std::vector<std::reference_wrapper<const model::INamedAutosarElement>>& m_result;
+        utilities::SymbolPath m_expected_path;
+        utilities::SymbolPath m_path;
     };
 
     class ElementByReferenceFinder : public dfs::TraversalCallback {
     public:
-        ElementByReferenceFinder(std::vector<std::string>& result, std::string expected_id)
+        ElementByReferenceFinder(std::vector<std::string>& result, const std::string& expected_id)
                 : m_result{result}
-                , m_expected_id{std::move(expected_id)}
+                , m_expected_path{utilities::SymbolPath::parse(expected_id)}
         {
 
         }
 
-        void visit(model::IAutosarElement& element) override;
-        void visit(model::IAutosarPackage& package) override;
-        void close(model::IAutosarPackage& package) override;
-        void close(model::IAutosarElement& package) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElement& package) override;
     private:
-        std::string m_expected_id;
         std::vector<std::string>& m_result;
-        std::vector<std::string> m_path;
+        utilities::SymbolPath m_expected_path;
+        utilities::SymbolPath m_path;
     };
 
     class RootElementFinder : public dfs::TraversalCallback {
     public:
-        RootElementFinder(std::optional<std::pair<std::string, model::INamedAutosarElement&>>& result,
+        RootElementFinder(std::optional<std::pair<std::string, const model::INamedAutosarElement&>>& result,
                           const std::string& full_path);
 
-        void visit(model::IAutosarElements& elements) override;
-        void visit(model::IAutosarPackage& package) override;
-        void close(model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarPackage& package) override;
     private:
-        std::optional<std::pair<std::string, model::INamedAutosarElement&>>& m_result;
-        std::vector<std::string> m_full_path;
-        std::vector<std::string> m_path;
+        std::optional<std::pair<std::string, const model::INamedAutosarElement&>>& m_result;
+        utilities::SymbolPath m_full_path;
+        utilities::SymbolPath m_path;
     };
 }
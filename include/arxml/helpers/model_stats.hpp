@@ -0,0 +1,68 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    // Memory taken by a loaded model, collected in a single traversal. Nodes are counted with the size of the
+    // library's own implementation. Strings, attribute lists and child vectors are counted with the heap memory
+    // they own, reserved capacity included. Names, tags and attribute values are interned and shared by all
+    // models, so they are reported once for the symbol table.
+    class ModelStats {
+    public:
+        static constexpr std::size_t ENTRY_TYPES = static_cast<std::size_t>(model::EntryType::REFERENCE_ELEMENT) + 1;
+
+        struct Footprint {
+            std::size_t nodes = 0;
+            std::size_t node_bytes = 0;
+            std::size_t string_bytes = 0;
+            std::size_t attribute_bytes = 0;
+            std::size_t vector_bytes = 0;
+
+            [[nodiscard]] std::size_t bytes() const noexcept {
+                return node_bytes + string_bytes + attribute_bytes + vector_bytes;
+            }
+            Footprint& operator+=(const Footprint& other) noexcept;
+        };
+
+        struct FileFootprint {
+            std::string file;
+            Footprint footprint;
+        };
+
+        static ModelStats collect(const model::IAutosarModel& model);
+
+        // Whole model, the root and all files
+        [[nodiscard]] const Footprint& total() const noexcept { return m_total; }
+        // In model order
+        [[nodiscard]] const std::vector<FileFootprint>& getFiles() const noexcept { return m_files; }
+        // Model entries count as PACKAGES, which is their type
+        [[nodiscard]] std::size_t count(model::EntryType type) const noexcept { return m_types[static_cast<std::size_t>(type)]; }
+        // Elements by tag, most frequent first
+        [[nodiscard]] std::vector<std::pair<utilities::Symbol, std::size_t>> getTags() const;
+
+        [[nodiscard]] std::size_t symbols() const noexcept { return m_symbols; }
+        [[nodiscard]] std::size_t symbolBytes() const noexcept { return m_symbol_bytes; }
+    private:
+        friend class ModelStatsBuilder;
+
+        Footprint m_total;
+        std::vector<FileFootprint> m_files;
+        std::array<std::size_t, ENTRY_TYPES> m_types{};
+        std::unordered_map<utilities::Symbol, std::size_t> m_tags;
+        std::size_t m_symbols = 0;
+        std::size_t m_symbol_bytes = 0;
+    };
+
+}
@@ -0,0 +1,78 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    // Namespace of the whole model. Packages with the same path in many entries are merged into one node, so
+    // a path is looked up once instead of in the tree of every file. Nodes are kept in a trie whose children are
+    // indexed by a single hash map keyed by parent and interned short name.
+    class NamespaceIndex {
+    public:
+        static constexpr std::uint32_t ROOT = 0;
+
+        struct Definition {
+            const model::IModelEntry* entry;
+            const model::IAutosarPackage* package;          // exactly one of package and element is set
+            const model::INamedAutosarElement* element;
+        };
+
+        struct Node {
+            std::uint32_t parent;
+            utilities::Symbol name;
+            std::vector<Definition> definitions;            // in model order
+            std::vector<std::uint32_t> children;            // in order of first definition
+        };
+
+        // Path defined more than once other than by packages, which are merged
+        struct Duplicate {
+            std::uint32_t node;
+            bool conflicting;   // definitions differ in kind or content, or their content hashes are unknown
+        };
+
+        // Identical duplicates are recognised by content hashes, so they need an annotated model
+        static NamespaceIndex build(const model::IAutosarModel& model);
+
+        // Absolute path, "/" is the root
+        [[nodiscard]] std::optional<std::uint32_t> find(std::string_view path) const;
+        [[nodiscard]] std::optional<std::uint32_t> child(std::uint32_t node, utilities::Symbol name) const;
+        [[nodiscard]] const Node& operator[](std::uint32_t node) const noexcept { return m_nodes[node]; }
+        [[nodiscard]] std::string path(std::uint32_t node) const;
+
+        [[nodiscard]] const std::vector<Duplicate>& getDuplicates() const noexcept { return m_duplicates; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_nodes.size(); }
+    private:
+        friend class NamespaceIndexBuilder;
+
+        struct ChildKey {
+            std::uint32_t parent;
+            const std::string* name;
+
+            bool operator==(const ChildKey& other) const noexcept = default;
+        };
+
+        struct ChildKeyHash {
+            std::size_t operator()(const ChildKey& key) const noexcept {
+                return std::hash<const void*>{}(key.name) * 31 + key.parent;
+            }
+        };
+
+        std::uint32_t addChild(std::uint32_t parent, utilities::Symbol name);
+
+        std::vector<Node> m_nodes;
+        std::unordered_map<ChildKey, std::uint32_t, ChildKeyHash> m_children;
+        std::vector<Duplicate> m_duplicates;
+    };
+
+}
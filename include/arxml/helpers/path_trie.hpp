@@ -0,0 +1,62 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arxml/elements.hpp>
+#include <arxml/helpers/namespace_index.hpp>
+
+namespace arxml::helpers {
+
+    // Read-only trie of package and named element paths, packages of all entries merged. It is a compact
+    // layout of the namespace index: children of every node are stored next to each other and sorted by short
+    // name, so a child is found by binary search and all children starting with a prefix form a single range.
+    class PathTrie {
+    public:
+        static constexpr std::uint32_t ROOT = 0;
+
+        struct Node {
+            utilities::Symbol name;
+            utilities::Symbol tag;          // empty for packages
+            std::uint32_t parent;
+            std::uint32_t first_child;
+            std::uint32_t children;
+        };
+
+        struct Completion {
+            std::string path;
+            std::uint32_t node;
+        };
+
+        static PathTrie build(const model::IAutosarModel& model);
+        static PathTrie build(const NamespaceIndex& index);
+
+        // Absolute path, "/" is the root
+        [[nodiscard]] std::optional<std::uint32_t> find(std::string_view path) const;
+        [[nodiscard]] std::optional<std::uint32_t> child(std::uint32_t node, std::string_view name) const;
+        [[nodiscard]] const Node& operator[](std::uint32_t node) const noexcept { return m_nodes[node]; }
+        [[nodiscard]] std::string path(std::uint32_t node) const;
+
+        // Children of the parent of the last segment whose names start with it, "/apd/Serv" completes to
+        // "/apd/ServiceInterfaces" and "/apd/Services", "/apd/" lists all children of /apd
+        [[nodiscard]] std::vector<Completion> complete(std::string_view prefix, std::size_t limit = SIZE_MAX) const;
+        // Completions together with all their descendants, in path order
+        [[nodiscard]] std::vector<Completion> enumerate(std::string_view prefix, std::size_t limit = SIZE_MAX) const;
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_nodes.size(); }
+        [[nodiscard]] std::size_t bytes() const noexcept { return m_nodes.capacity() * sizeof(Node); }
+    private:
+        // Range of children of the parent of the last segment, which start with that segment
+        [[nodiscard]] std::optional<std::pair<std::uint32_t, std::uint32_t>> completionRange(std::string_view prefix) const;
+
+        std::vector<Node> m_nodes;
+    };
+
+}
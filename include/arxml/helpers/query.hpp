@@ -0,0 +1,95 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arxml/dfs/callbacks.hpp>
+#include <arxml/utilities/symbols.hpp>
+
+namespace arxml::helpers {
+
+    struct QueryPredicate;
+
+    struct QueryStep {
+        enum class Kind {
+            NAME,       // short name of the package or named element, or tag of any element
+            ANY,        // '*' - exactly one level
+            ANY_DEPTH   // '**' - zero or more levels
+        };
+
+        Kind kind;
+        utilities::Symbol name;     // interned on compilation, so steps are compared with model symbols
+        std::vector<QueryPredicate> predicates;
+    };
+
+    // [RELATIVE/PATH] holds when the path matches below the node, [RELATIVE/PATH='value'] additionally
+    // compares the text of the matched simple element (or the short name for SHORT-NAME)
+    struct QueryPredicate {
+        std::vector<QueryStep> path;
+        std::optional<std::string> value;
+    };
+
+    // Query in the form /apd/**/SERVICE-INTERFACE[EVENTS/VARIABLE-DATA-PROTOTYPE]/SHORT-NAME. Every step
+    // matches one package or element; AR-PACKAGES and ELEMENTS containers are transparent. SHORT-NAME
+    // as the last step selects the short name of the matched package or named element.
+    class CompiledQuery {
+    public:
+        static constexpr std::size_t MAX_STEPS = 63;
+
+        static CompiledQuery compile(std::string_view query);
+
+        [[nodiscard]] const std::vector<QueryStep>& getSteps() const noexcept { return m_steps; }
+        [[nodiscard]] const std::string& getText() const noexcept { return m_text; }
+    private:
+        CompiledQuery(std::string text, std::vector<QueryStep> steps);
+
+        std::string m_text;
+        std::vector<QueryStep> m_steps;
+    };
+
+    struct QueryMatch {
+        std::string path;
+        const model::IAutosarModelObject& object;   // matched package or element, owner for SHORT-NAME
+        std::string value;                      // text of simple elements and short names
+    };
+
+    // Evaluates the query as a non-deterministic automaton with one state per step. The set of active
+    // states is kept per depth; subtrees reached with no live state are skipped.
+    class QueryMatcher : public dfs::TraversalCallback {
+    public:
+        // Properties of the visited node the steps are tested against
+        struct Node {
+            const model::IAutosarModelObject& object;
+            utilities::Symbol name;     // empty for unnamed elements
+            utilities::Symbol tag;
+        };
+
+        QueryMatcher(const CompiledQuery& query, std::vector<QueryMatch>& result);
+
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElement& element) override;
+    private:
+        using StateSet = std::uint64_t;
+
+        dfs::VisitResult enter(const Node& node);
+        void leave();
+
+        const CompiledQuery& m_query;
+        std::vector<QueryMatch>& m_result;
+        std::vector<StateSet> m_states;
+        std::vector<utilities::Symbol> m_path;
+    };
+
+    std::vector<QueryMatch> run_query(const model::IAutosarModel& model, std::string_view query);
+    std::vector<QueryMatch> run_query(const model::IAutosarModel& model, const CompiledQuery& query);
+
+}
@@ -0,0 +1,37 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arxml/elements.hpp>
+#include <arxml/utilities/model_component_factory.hpp>
+
+namespace arxml::helpers {
+
+    // Extracts the part of the model reachable from the given root paths. Top level elements (direct children
+    // of ELEMENTS) are the unit of extraction; references pointing into nested named elements pull in the
+    // enclosing top level element. A root path may name an element or a package.
+    class ModelSlicer {
+    public:
+        explicit ModelSlicer(model::IAutosarModel& model);
+
+        [[nodiscard]] std::set<std::string> collectReachable(const std::vector<std::string>& roots) const;
+
+        // Moves reachable elements out of the source model into a new one. The source model keeps
+        // the remaining elements and stays consistent.
+        std::unique_ptr<model::IAutosarModel> slice(const std::vector<std::string>& roots,
+                                                    const utilities::parser::IModelComponentFactory& factory);
+    private:
+        [[nodiscard]] const std::string* resolve(const std::string& path) const;
+
+        model::IAutosarModel& m_model;
+        std::unordered_map<std::string, std::vector<std::string>> m_references;
+    };
+
+}
@@ -0,0 +1,45 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <arxml/dfs/callbacks.hpp>
+#include <arxml/utilities/symbols.hpp>
+
+namespace arxml::helpers {
+
+    // Tree of tags used below one top level tag, merged over all of its elements
+    struct StructureEntry {
+        utilities::Symbol tag;
+        std::size_t counter = 0;
+        std::vector<utilities::Symbol> referenced_types;
+        // In order of the first appearance, named elements start with their SHORT-NAME
+        std::vector<std::unique_ptr<StructureEntry>> entries;
+    };
+
+    // Collects the structure of top level elements while traversing the model, so it can be run
+    // together with finders and queries under a single traversal.
+    class StructureCollector : public dfs::TraversalCallback {
+    public:
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+        void close(const model::IAutosarElement& element) override;
+
+        // Keyed by the interned text, so top level tags are listed in order
+        [[nodiscard]] const std::map<std::string_view, StructureEntry>& getEntries() const noexcept {
+            return m_entries;
+        }
+    private:
+        StructureEntry& entryFor(const model::IAutosarElement& element);
+
+        std::map<std::string_view, StructureEntry> m_entries;
+        std::vector<StructureEntry*> m_stack;
+    };
+
+}
@@ -0,0 +1,57 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    struct TextMatch {
+        std::string path;       // leaf path for text values, element or package path for short names
+        std::string_view text;
+    };
+
+    // Substring index over text values and short names. Every distinct text is stored once and searched
+    // through a suffix array, so lookups neither traverse nor reference the model.
+    class TextIndex {
+    public:
+        static TextIndex build(const model::IAutosarModel& model);
+
+        // Matches in model order; the pattern must not be empty
+        [[nodiscard]] std::vector<TextMatch> find(std::string_view pattern) const;
+
+        [[nodiscard]] std::size_t documents() const noexcept { return m_documents.size(); }
+        [[nodiscard]] std::size_t bytes() const noexcept;
+    private:
+        friend class TextIndexBuilder;
+
+        struct Node {
+            std::uint32_t parent;
+            utilities::Symbol segment;
+        };
+
+        struct Document {
+            std::uint32_t node;
+            std::uint32_t text;
+        };
+
+        [[nodiscard]] std::string path(std::uint32_t node) const;
+        [[nodiscard]] std::string_view text(std::uint32_t text) const;
+
+        std::vector<Node> m_nodes;
+        std::vector<Document> m_documents;
+        std::string m_texts;                        // distinct texts, each terminated with '\0'
+        std::vector<std::uint32_t> m_text_offsets;  // start of every distinct text in m_texts
+        std::vector<std::uint32_t> m_postings;      // documents grouped by text
+        std::vector<std::uint32_t> m_posting_offsets;
+        std::vector<std::uint32_t> m_suffixes;
+    };
+
+}
@@ -0,0 +1,16 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <string>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::helpers {
+
+    // Textual value of the simple element; floating values use the shortest round-trip representation
+    std::string simple_value(const model::ISimpleAutosarElement& element);
+
+}
@@ -16,12 +16,12 @@ namespace arxml::printer {
     class TreePrinter {
     public:
         explicit TreePrinter(std::ostream& stream, int indent = 4);
-        void print(model::IAutosarModel& root);
-        void print(model::IModelEntry& root);
-        void print(model::IAutosarPackages& packages);
-        void print(model::IAutosarPackage& package);
-        void print(model::IAutosarElements& elements);
-        void print(model::IAutosarElement& element);
+        void print(const model::IAutosarModel& root);
+        void print(const model::IModelEntry& root);
+        void print(const model::IAutosarPackages& packages);
+        void print(const model::IAutosarPackage& package);
+        void print(const model::IAutosarElements& elements);
+        void print(const model::IAutosarElement& element);
 
         template<class AutosarModelObject>
         static void stdout_dump(AutosarModelObject& object, int tab_size = 4);
@@ -39,12 +39,12 @@ namespace arxml::printer {
     class ArxmlPrinter {
     public:
         explicit ArxmlPrinter(std::ostream& stream, int indent = 4);
-        void print(model::IAutosarModel& root);
-        void print(model::IModelEntry& root);
-        void print(model::IAutosarPackages& packages);
-        void print(model::IAutosarPackage& package);
-        void print(model::IAutosarElements& elements);
-        void print(model::IAutosarElement& element);
+        void print(const model::IAutosarModel& root);
+        void print(const model::IModelEntry& root);
+        void print(const model::IAutosarPackages& packages);
+        void print(const model::IAutosarPackage& package);
+        void print(const model::IAutosarElements& elements);
+        void print(const model::IAutosarElement& element);
 
         template<class AutosarModelObject>
         static void stdout_dump(AutosarModelObject& object, int tab_size = 4);
@@ -57,4 +57,30 @@ namespace arxml::printer {
         ArxmlPrinter printer(std::cout, tab_size);
         printer.print(object);
     }
+
+    enum class JsonFormat {
+        JSON,   // single document
+        NDJSON  // one record per top level element, carrying its file and path
+    };
+
+    class JsonPrinterCallback;
+
+    // Streams the model as JSON during the traversal, no document is built in memory. Output is collected
+    // in a buffer which is written to the stream in large chunks and flushed at the end of every print.
+    class JsonPrinter {
+    public:
+        explicit JsonPrinter(std::ostream& stream, JsonFormat format = JsonFormat::JSON);
+        ~JsonPrinter();
+        void print(const model::IAutosarModel& root);
+        void print(const model::IModelEntry& root);
+        void print(const model::IAutosarPackages& packages);
+        void print(const model::IAutosarPackage& package);
+        void print(const model::IAutosarElements& elements);
+        void print(const model::IAutosarElement& element);
+    private:
+        template<class AutosarModelObject>
+        void print_object(const AutosarModelObject& object);
+
+        std::unique_ptr<JsonPrinterCallback> m_callback;
+    };
 }
@@ -4,31 +4,145 @@
 
 #pragma once
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include <arxml/utilities/bounded_queue.hpp>
+#include <arxml/utilities/package_filter.hpp>
 #include <arxml/utilities/parser_facade.hpp>
+#include <arxml/utilities/tracing.hpp>
 
 namespace arxml::project {
 
     class ModelProject {
     public:
+        // Number of discovered files which may wait for a parser, all of them are already being prefetched
+        static constexpr std::size_t PREFETCH_DEPTH = 16;
+        // Number of found files among which the largest one is scheduled first
+        static constexpr std::size_t SCHEDULING_WINDOW = 16;
+
         ModelProject() = default;
 
         bool addFile(const std::string& file);
+        // Directories are walked only when the model is opened, concurrently with parsing. Besides .arxml files
+        // also .arxml.gz and .arxml.zst ones are picked up when the library can decompress them.
         bool addDirectory(const std::string& directory);
-        [[nodiscard]] const std::vector<std::string>& getFileList() const { return m_files; }
+        // Files given to addFile only, files of added directories are known once discovery walks them
+        [[nodiscard]] const std::vector<std::string>& getExplicitFiles() const { return m_files; }
+        [[nodiscard]] const std::vector<std::string>& getDirectories() const { return m_directories; }
+
+        // Globs with * and ? matching within a segment and ** matching any number of segments. Patterns without
+        // a slash are matched against file names, others against paths relative to the added directory.
+        // When include patterns are given a file has to match one of them; matching any exclude pattern drops it.
+        void addIncludePattern(std::string pattern) { m_include.push_back(std::move(pattern)); }
+        void addExcludePattern(std::string pattern) { m_exclude.push_back(std::move(pattern)); }
+        [[nodiscard]] bool isSelected(const std::string& relative_path) const;
+
+        // Passed to facades which accept a package filter, other facades build all packages
+        void addPackageFilter(std::string_view prefix) { m_package_filter.addPrefix(prefix); }
+        [[nodiscard]] const utilities::PackageFilter& getPackageFilter() const noexcept { return m_package_filter; }
+
+        // Pushes selected files while walking the directories, prefetching every one of them. Of the last
+        // SCHEDULING_WINDOW found files the largest is pushed first, so that the longest parses start early
+        // without waiting for the whole walk. The queue is closed when discovery ends, also when it fails or
+        // the queue was closed by a consumer.
+        void discover(utilities::BoundedQueue<std::string>& queue) const;
 
         template<typename ParserFacade>
         static void openModelFromProject(const ModelProject& project, ParserFacade& facade);
+
+        // Calls the worker for every selected file from as many threads as the hardware offers
+        template<typename Worker>
+        static void forEachFile(const ModelProject& project, Worker worker);
     private:
+        template<typename Worker>
+        static void runPipeline(const ModelProject& project, std::size_t workers, Worker worker);
+
         std::vector<std::string> m_files;
+        std::vector<std::string> m_directories;
+        std::vector<std::string> m_include;
+        std::vector<std::string> m_exclude;
+        utilities::PackageFilter m_package_filter;
     };
 
+    template<typename Worker>
+    void ModelProject::runPipeline(const ModelProject& project, std::size_t workers, Worker worker) {
+        utilities::BoundedQueue<std::string> queue(PREFETCH_DEPTH);
+        auto discovery = std::async(std::launch::async, [&]() { project.discover(queue); });
+        auto consume = [&]() {
+            try {
+                while (auto file = queue.pop()) {
+                    worker(*file);
+                }
+            }
+            catch (...) {
+                queue.close();
+                throw;
+            }
+        };
+        std::vector<std::future<void>> parsers;
+        for (std::size_t it = 1; it < workers; ++it) {
+            parsers.push_back(std::async(std::launch::async, consume));
+        }
+
+        // The calling thread is one of the workers
+        std::exception_ptr failure;
+        try {
+            consume();
+        }
+        catch (...) {
+            failure = std::current_exception();
+        }
+        for (auto& it: parsers) {
+            try {
+                it.get();
+            }
+            catch (...) {
+                failure = failure ? failure : std::current_exception();
+            }
+        }
+        try {
+            discovery.get();
+        }
+        catch (...) {
+            failure = failure ? failure : std::current_exception();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    template<typename Worker>
+    void ModelProject::forEachFile(const ModelProject& project, Worker worker) {
+        runPipeline(project, std::max(1u, std::thread::hardware_concurrency()), std::move(worker));
+    }
+
     template<typename ParserFacade>
     void ModelProject::openModelFromProject(const arxml::project::ModelProject& project, ParserFacade& facade) {
-        for (const auto& it: project.getFileList()) {
-            facade.parse(it);
+        if constexpr (requires { facade.setPackageFilter(project.getPackageFilter()); }) {
+            facade.setPackageFilter(project.getPackageFilter());
+        }
+        if constexpr (utilities::ConcurrentParserFacade<ParserFacade>) {
+            std::mutex model_mutex;
+            auto workers = std::max(1u, std::thread::hardware_concurrency());
+            runPipeline(project, workers, [&](const std::string& file) {
+                ARXML_TRACE_SCOPE("parse", file);
+                auto entry = std::as_const(facade).parseEntry(file);
+                std::lock_guard lock(model_mutex);
+                facade.addEntry(file, std::move(entry));
+            });
+        }
+        else {
+            runPipeline(project, 1, [&](const std::string& file) {
+                ARXML_TRACE_SCOPE("parse", file);
+                facade.parse(file);
+            });
         }
     }
 
@@ -0,0 +1,29 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <memory>
+
+#include <arxml/elements.hpp>
+
+namespace arxml::model {
+
+    // Immutable, reference counted model shared between threads. Only the const interface is reachable,
+    // so readers need no locking; the model is released together with the last copy of the snapshot.
+    class ModelSnapshot {
+    public:
+        ModelSnapshot() = default;
+        explicit ModelSnapshot(std::unique_ptr<IAutosarModel> model) : m_model{std::move(model)} {}
+
+        [[nodiscard]] const IAutosarModel& get() const noexcept { return *m_model; }
+        const IAutosarModel& operator*() const noexcept { return *m_model; }
+        const IAutosarModel* operator->() const noexcept { return m_model.get(); }
+        explicit operator bool() const noexcept { return static_cast<bool>(m_model); }
+        [[nodiscard]] long useCount() const noexcept { return m_model.use_count(); }
+    private:
+        std::shared_ptr<const IAutosarModel> m_model;
+    };
+
+}
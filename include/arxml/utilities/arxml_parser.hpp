@@ -6,7 +6,9 @@
 
 #include "model_component_factory.hpp"
 #include "arxml/elements.hpp"
+#include "arxml/utilities/diagnostics.hpp"
 #include "arxml/utilities/input_source.hpp"
+#include "arxml/utilities/package_filter.hpp"
 
 namespace arxml::utilities::parser {
 
@@ -15,19 +17,47 @@ namespace arxml::utilities::parser {
         explicit ArxmlFileParser(IModelComponentFactory& element_factory)
         : m_element_factory{element_factory}
         , m_root{}
+        , m_content_hashing{false}
+        , m_diagnostics{&Diagnostics::instance()}
         {
 
         }
 
+        // Problems in the input are reported to the diagnostics: broken subtrees are skipped, files which cannot
+        // be read or are not well formed XML are left out of the model
         void parseSource(const std::string& unit_name, utilities::io::IInputSource &source);
 
+        // Builds the entry of a single unit without touching the model, may be called from many threads at once.
+        // Returns null for a skipped file.
+        [[nodiscard]] std::unique_ptr<model::IModelEntry> parseEntry(const std::string& unit_name,
+                                                                     utilities::io::IInputSource& source) const;
+        // Skipped (null) entries are ignored
+        void addEntry(const std::string& unit_name, std::unique_ptr<model::IModelEntry> entry);
+
+        // Annotates every parsed file with content hashes right after it is built
+        void setContentHashing(bool enabled) { m_content_hashing = enabled; }
+
+        // Packages and their elements not covered by the filter are skipped without being built; packages which
+        // only lead to a prefix are kept when something below them is covered
+        void setPackageFilter(PackageFilter filter) { m_package_filter = std::move(filter); }
+
+        void setDiagnostics(Diagnostics& diagnostics) { m_diagnostics = &diagnostics; }
+        [[nodiscard]] Diagnostics& getDiagnostics() const noexcept { return *m_diagnostics; }
+
+        // Model without entries when nothing was parsed
         std::unique_ptr<model::IAutosarModel> build() {
-            return std::move(m_root);
+            return m_root ? std::move(m_root) : m_element_factory.createRoot();
         }
 
     private:
+        [[nodiscard]] std::unique_ptr<model::IModelEntry> buildEntry(const std::string& unit_name,
+                                                                     utilities::io::IInputSource& source) const;
+
         IModelComponentFactory& m_element_factory;
         std::unique_ptr<model::IAutosarModel> m_root;
+        bool m_content_hashing;
+        PackageFilter m_package_filter;
+        Diagnostics* m_diagnostics;
     };
 
 }
\ No newline at end of file
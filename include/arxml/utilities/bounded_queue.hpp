@@ -0,0 +1,69 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace arxml::utilities {
+
+    // Multi producer, multi consumer queue. Producers block while the queue is full, consumers while it is
+    // empty. Closing wakes everybody: pushing fails from then on and popping drains the remaining items.
+    template<typename T>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(std::size_t capacity)
+        : m_capacity{capacity == 0 ? 1 : capacity}
+        , m_closed{false}
+        {
+
+        }
+
+        bool push(T item) {
+            std::unique_lock lock(m_mutex);
+            m_not_full.wait(lock, [this]() { return m_closed or m_items.size() < m_capacity; });
+            if (m_closed) {
+                return false;
+            }
+            m_items.push_back(std::move(item));
+            lock.unlock();
+            m_not_empty.notify_one();
+            return true;
+        }
+
+        std::optional<T> pop() {
+            std::unique_lock lock(m_mutex);
+            m_not_empty.wait(lock, [this]() { return m_closed or not m_items.empty(); });
+            if (m_items.empty()) {
+                return std::nullopt;
+            }
+            auto item = std::move(m_items.front());
+            m_items.pop_front();
+            lock.unlock();
+            m_not_full.notify_one();
+            return item;
+        }
+
+        void close() {
+            {
+                std::lock_guard lock(m_mutex);
+                m_closed = true;
+            }
+            m_not_full.notify_all();
+            m_not_empty.notify_all();
+        }
+    private:
+        std::size_t m_capacity;
+        bool m_closed;
+        std::mutex m_mutex;
+        std::condition_variable m_not_full;
+        std::condition_variable m_not_empty;
+        std::deque<T> m_items;
+    };
+
+}
@@ -0,0 +1,49 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arxml::utilities {
+
+    enum class Severity {
+        WARNING,    // input was understood differently than written, parsing went on
+        ERROR       // the subtree or the whole file was skipped
+    };
+
+    struct Diagnostic {
+        Severity severity;
+        std::string file;
+        int line;           // 0 when unknown
+        std::string message;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const Diagnostic& diagnostic);
+
+    // Problems found in the input, collected instead of stopping at the first one. Reporting is thread safe,
+    // so parsers of many files may share one instance.
+    class Diagnostics {
+    public:
+        Diagnostics() = default;
+
+        // Collects diagnostics of parsers which were not given their own instance
+        static Diagnostics& instance();
+
+        void report(Diagnostic diagnostic);
+        void clear();
+
+        // Ordered by file and line
+        [[nodiscard]] std::vector<Diagnostic> get() const;
+        [[nodiscard]] std::size_t count(Severity severity) const;
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<Diagnostic> m_diagnostics;
+    };
+
+}
@@ -5,12 +5,16 @@
 #pragma once
 
 #include <fstream>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace arxml::utilities::io {
 
     class IInputSource {
     public:
+        virtual ~IInputSource() = default;
         virtual std::string getContent() = 0;
         virtual bool open(std::string_view input) = 0;
         virtual bool isOpened() = 0;
@@ -40,6 +44,75 @@ namespace arxml::utilities::io {
         bool m_opened;
     };
 
+    // Reads compressed file in fixed size chunks and inflates them straight into the returned content
+    class GzipFileSource : public IInputSource {
+    public:
+        explicit GzipFileSource(std::string filename)
+        : m_input(std::move(filename), std::ios::binary)
+        , m_opened(true)
+        {
+
+        }
+
+        GzipFileSource()
+        : m_input()
+        , m_opened(false)
+        {
+
+        }
+
+        std::string getContent() override;
+        bool isOpened() override { return m_opened; };
+        bool open(std::string_view filename) override;
+    private:
+        std::ifstream m_input;
+        bool m_opened;
+    };
+
+    class ZstdFileSource : public IInputSource {
+    public:
+        explicit ZstdFileSource(std::string filename)
+        : m_input(std::move(filename), std::ios::binary)
+        , m_opened(true)
+        {
+
+        }
+
+        ZstdFileSource()
+        : m_input()
+        , m_opened(false)
+        {
+
+        }
+
+        std::string getContent() override;
+        bool isOpened() override { return m_opened; };
+        bool open(std::string_view filename) override;
+    private:
+        std::ifstream m_input;
+        bool m_opened;
+    };
+
+    enum class Compression {
+        NONE,
+        GZIP,
+        ZSTD
+    };
+
+    // Recognises .arxml, .arxml.gz and .arxml.zst files
+    [[nodiscard]] std::optional<Compression> model_file_compression(std::string_view filename) noexcept;
+    // Compressed formats are read only when the library was built with zlib or zstd respectively
+    [[nodiscard]] bool is_compression_available(Compression compression) noexcept;
+    // Name of the file without .gz or .zst extension
+    [[nodiscard]] std::string uncompressed_name(const std::string& filename);
+
+    // Source reading the file through the decompression chosen by its extension
+    std::unique_ptr<IInputSource> open_file_source(const std::string& filename);
+
+    // Asks the operating system to start reading the file in the background, so a later read hits the page
+    // cache. Does nothing where no such hint is available.
+    void prefetch_file(const std::string& filename) noexcept;
+
     class StringSource : public IInputSource {
     public:
         explicit StringSource(std::string content)
@@ -0,0 +1,131 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace arxml::utilities::instrumentation {
+
+    enum class Phase {
+        READ,
+        XML_PARSING,
+        MODEL_BUILDING,
+        VALUE_CLASSIFICATION,
+        ALLOCATION,
+        REGISTRATION,
+        CONTENT_HASHING,
+        TRAVERSAL,
+        COUNT
+    };
+
+    enum class Counter {
+        BYTES,
+        PACKAGES,
+        NAMED_ELEMENTS,
+        COMPOSITE_ELEMENTS,
+        SIMPLE_ELEMENTS,
+        ALLOCATIONS,
+        COUNT
+    };
+
+    constexpr auto PHASE_COUNT = static_cast<std::size_t>(Phase::COUNT);
+    constexpr auto COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNT);
+
+#ifdef ARXML_ENABLE_PROFILING
+    constexpr bool PROFILING_AVAILABLE = true;
+#else
+    constexpr bool PROFILING_AVAILABLE = false;
+#endif
+
+    // Statistics of a single profiled unit (usually one parsed file). Work done outside of any unit,
+    // e.g. traversals of the complete model, is accounted to the global unit.
+    struct UnitProfile {
+        explicit UnitProfile(std::string unit_name) : name{std::move(unit_name)} {}
+
+        std::string name;
+        std::array<std::atomic<std::uint64_t>, PHASE_COUNT> nanoseconds{};
+        std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> counters{};
+    };
+
+    class Profiler {
+    public:
+        static Profiler& instance();
+
+        void enable(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+        [[nodiscard]] bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+        UnitProfile& registerUnit(std::string name);
+        UnitProfile& globalUnit() noexcept { return m_global; }
+        void report(std::ostream& os) const;
+    private:
+        Profiler() = default;
+
+        std::atomic<bool> m_enabled{false};
+        mutable std::mutex m_mutex;
+        std::deque<UnitProfile> m_units;
+        UnitProfile m_global{"(global)"};
+    };
+
+    UnitProfile& current_unit() noexcept;
+
+    inline void count(Counter counter, std::uint64_t value) {
+        if (Profiler::instance().isEnabled()) {
+            current_unit().counters[static_cast<std::size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    // Makes the given unit current for the calling thread until the end of the scope
+    class UnitScope {
+    public:
+        explicit UnitScope(std::string_view name);
+        ~UnitScope();
+        UnitScope(const UnitScope&) = delete;
+        UnitScope& operator=(const UnitScope&) = delete;
+    private:
+        UnitProfile* m_previous;
+        bool m_active;
+    };
+
+    // Measures exclusive time of the phase: a nested timer pauses the enclosing one
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Phase phase);
+        ~ScopedTimer();
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void pause(Clock::time_point now);
+
+        UnitProfile* m_unit;
+        Phase m_phase;
+        Clock::time_point m_start;
+        ScopedTimer* m_parent;
+    };
+
+}
+
+#ifdef ARXML_ENABLE_PROFILING
+#define ARXML_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ARXML_PROFILE_CONCAT(a, b) ARXML_PROFILE_CONCAT_IMPL(a, b)
+#define ARXML_PROFILE_SCOPE(phase) \
+    ::arxml::utilities::instrumentation::ScopedTimer ARXML_PROFILE_CONCAT(arxml_profile_timer_, __LINE__){phase}
+#define ARXML_PROFILE_UNIT(name) \
+    ::arxml::utilities::instrumentation::UnitScope ARXML_PROFILE_CONCAT(arxml_profile_unit_, __LINE__){name}
+#define ARXML_PROFILE_COUNT(counter, value) ::arxml::utilities::instrumentation::count(counter, value)
+#else
+#define ARXML_PROFILE_SCOPE(phase) do {} while (false)
+#define ARXML_PROFILE_UNIT(name) do {} while (false)
+#define ARXML_PROFILE_COUNT(counter, value) do {} while (false)
+#endif
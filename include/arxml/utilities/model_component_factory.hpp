@@ -5,6 +5,7 @@
 #pragma once
 
 #include "arxml/elements.hpp"
+#include "arxml/utilities/model_memory.hpp"
 
 namespace arxml::utilities::parser {
 
@@ -22,10 +23,18 @@ namespace arxml::utilities::parser {
         virtual std::unique_ptr<model::ISimpleAutosarElement> createNumberElement(std::string tag, double value) const noexcept = 0;
         virtual std::unique_ptr<model::ISimpleAutosarElement> createNumberElement(std::string tag, int value) const noexcept = 0;
         virtual std::unique_ptr<model::ISimpleAutosarElement> createStringElement(std::string tag, std::string value) const noexcept = 0;
+        virtual std::unique_ptr<model::ISimpleAutosarElement> createReferenceElement(std::string tag, std::string target, std::string_view destination) const noexcept = 0;
     };
 
     class ModelComponentFactory : public IModelComponentFactory {
     public:
+        ModelComponentFactory() = default;
+        // Nodes are created in the memory resource, which has to outlive them
+        explicit ModelComponentFactory(ModelMemoryResource& memory) : m_memory{&memory} {}
+
+        void setMemoryResource(ModelMemoryResource* memory) noexcept { m_memory = memory; }
+        [[nodiscard]] ModelMemoryResource* getMemoryResource() const noexcept { return m_memory; }
+
         [[nodiscard]] std::unique_ptr<model::IAutosarModel> createRoot() const noexcept override;
         [[nodiscard]] std::unique_ptr<model::IModelEntry> createModelEntry(std::string unit_name, std::string xmlns, std::string xmlns_xsi, std::string xmlns_schema_location) const noexcept override;
         [[nodiscard]] std::unique_ptr<model::IAutosarPackages> createPackages() const noexcept override;
@@ -37,5 +46,8 @@ namespace arxml::utilities::parser {
         [[nodiscard]] std::unique_ptr<model::ISimpleAutosarElement> createNumberElement(std::string tag, double value) const noexcept override;
         [[nodiscard]] std::unique_ptr<model::ISimpleAutosarElement> createNumberElement(std::string tag, int value) const noexcept override;
         [[nodiscard]] std::unique_ptr<model::ISimpleAutosarElement> createStringElement(std::string tag, std::string value) const noexcept override;
+        [[nodiscard]] std::unique_ptr<model::ISimpleAutosarElement> createReferenceElement(std::string tag, std::string target, std::string_view destination) const noexcept override;
+    private:
+        ModelMemoryResource* m_memory = nullptr;    // heap when not set
     };
 }
@@ -0,0 +1,68 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace arxml::utilities {
+
+    // Memory for the nodes of a model, handed out by bumping a pointer through large chunks. Nodes are never
+    // given back one by one: deleting a node only runs its destructor, and release() makes all chunks
+    // available to the next load at once, so reloading a model of similar size takes nothing from the system.
+    // Every thread bumps through its own chunk, parsers running in parallel meet only when one is used up.
+    class ModelMemoryResource {
+    public:
+        static constexpr std::size_t CHUNK_SIZE = 1 << 20;
+        static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+        ModelMemoryResource();
+        ModelMemoryResource(const ModelMemoryResource&) = delete;
+        ModelMemoryResource& operator=(const ModelMemoryResource&) = delete;
+        // Objects allocated here must not outlive the resource
+        ~ModelMemoryResource();
+
+        // Resource the pointer was allocated from, nullptr for memory of any other origin
+        [[nodiscard]] static ModelMemoryResource* owner(const void* pointer) noexcept;
+
+        [[nodiscard]] void* allocate(std::size_t size);
+        void deallocate(void* pointer) noexcept;
+
+        // Reuses all chunks for the next load. Throws std::logic_error while objects allocated here are alive,
+        // must not run concurrently with allocate.
+        void release();
+
+        [[nodiscard]] std::size_t live() const noexcept { return m_live.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::size_t bytesReserved() const;
+    private:
+        // Chunks are aligned to CHUNK_SIZE, which lets owner find them by address
+        struct ChunkDeleter {
+            void operator()(std::byte* memory) const noexcept {
+                ::operator delete(memory, std::align_val_t{CHUNK_SIZE});
+            }
+        };
+        using ChunkMemory = std::unique_ptr<std::byte[], ChunkDeleter>;
+
+        struct Chunk {
+            ChunkMemory memory;
+            std::size_t size;
+        };
+
+        std::span<std::byte> takeChunk(std::size_t size);
+
+        mutable std::mutex m_mutex;
+        std::vector<Chunk> m_used;
+        std::vector<Chunk> m_free;
+        std::atomic<std::uint64_t> m_generation;
+        std::atomic<std::size_t> m_live;
+    };
+
+}
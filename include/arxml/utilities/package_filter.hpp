@@ -0,0 +1,34 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arxml::utilities {
+
+    // Set of package path prefixes like /apd/ServiceInterfaces. Prefixes are compared segment by segment,
+    // so /apd covers /apd/Types but not /apdx. An empty filter covers every package.
+    class PackageFilter {
+    public:
+        enum class Match {
+            NONE,       // neither the package nor anything below it is covered
+            ANCESTOR,   // the package is not covered, but some of its descendants may be
+            INSIDE      // the package and everything below it is covered
+        };
+
+        PackageFilter() = default;
+
+        void addPrefix(std::string_view prefix);
+        [[nodiscard]] bool empty() const noexcept { return m_prefixes.empty(); }
+
+        // Package is given by short names of the package itself and all of its parents, outermost first
+        [[nodiscard]] Match match(const std::vector<std::string_view>& package_path) const;
+    private:
+        std::vector<std::vector<std::string>> m_prefixes;
+    };
+
+}
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <concepts>
+#include <memory>
+#include <string>
+
 #include <arxml/utilities/model_component_factory.hpp>
 #include <arxml/utilities/arxml_parser.hpp>
 #include <arxml/utilities/input_source.hpp>
@@ -18,6 +22,14 @@ namespace arxml::utilities {
         virtual std::unique_ptr<model::IAutosarModel> getModel() = 0;
     };
 
+    // Facade able to parse many files at once; only adding the parsed entries to the model has to be serialized
+    template<typename ParserFacade>
+    concept ConcurrentParserFacade = requires(const ParserFacade& parser, ParserFacade& model, const std::string& file,
+                                              std::unique_ptr<model::IModelEntry> entry) {
+        { parser.parseEntry(file) } -> std::same_as<std::unique_ptr<model::IModelEntry>>;
+        model.addEntry(file, std::move(entry));
+    };
+
     class DefaultParserFacade : public IParserFacade {
     public:
         DefaultParserFacade()
@@ -28,7 +40,17 @@ namespace arxml::utilities {
         }
 
         void parse(const std::string& filename) override;
+        [[nodiscard]] std::unique_ptr<model::IModelEntry> parseEntry(const std::string& filename) const;
+        void addEntry(const std::string& filename, std::unique_ptr<model::IModelEntry> entry) {
+            m_parser.addEntry(filename, std::move(entry));
+        }
         std::unique_ptr<model::IAutosarModel> getModel() override { return m_parser.build(); }
+        void enableContentHashing() { m_parser.setContentHashing(true); }
+        void setPackageFilter(PackageFilter filter) { m_parser.setPackageFilter(std::move(filter)); }
+        void setDiagnostics(Diagnostics& diagnostics) { m_parser.setDiagnostics(diagnostics); }
+        [[nodiscard]] Diagnostics& getDiagnostics() const noexcept { return m_parser.getDiagnostics(); }
+        // Models built afterwards live in the memory resource and have to be destroyed before it is released
+        void setMemoryResource(ModelMemoryResource& memory) { m_factory.setMemoryResource(&memory); }
     private:
         utilities::parser::ModelComponentFactory m_factory;
         utilities::parser::ArxmlFileParser m_parser;
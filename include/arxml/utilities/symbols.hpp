@@ -0,0 +1,107 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace arxml::utilities {
+
+    // Handle of an interned string. Equal strings share one handle, so comparison and hashing work on the
+    // address; the text stays valid until the end of the program.
+    class Symbol {
+    public:
+        Symbol() = default;
+
+        [[nodiscard]] std::string_view view() const noexcept { return m_value ? std::string_view(*m_value) : std::string_view{}; }
+        [[nodiscard]] bool empty() const noexcept { return m_value == nullptr; }
+        [[nodiscard]] const std::string* address() const noexcept { return m_value; }
+
+        bool operator==(const Symbol& other) const noexcept { return m_value == other.m_value; }
+        bool operator!=(const Symbol& other) const noexcept { return m_value != other.m_value; }
+    private:
+        friend class SymbolTable;
+        explicit Symbol(const std::string* value) : m_value{value} {}
+
+        const std::string* m_value = nullptr;
+    };
+
+    // Process wide, thread safe string pool. Lookups of already known strings take a shared lock only.
+    class SymbolTable {
+    public:
+        static SymbolTable& instance();
+
+        Symbol intern(std::string_view value);
+        // Returns empty symbol when the value was never interned
+        [[nodiscard]] Symbol find(std::string_view value) const;
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] std::size_t bytes() const;
+    private:
+        SymbolTable() = default;
+
+        mutable std::shared_mutex m_mutex;
+        std::deque<std::string> m_storage;
+        std::unordered_map<std::string_view, const std::string*> m_index;
+        std::size_t m_bytes = 0;
+    };
+
+    inline Symbol intern(std::string_view value) {
+        return SymbolTable::instance().intern(value);
+    }
+
+    // Slash separated path of interned segments. Every level keeps the rolling hash of the path up to it,
+    // so paths are extended, compared and looked up level by level without building strings.
+    class SymbolPath {
+    public:
+        SymbolPath() = default;
+
+        // Segments which were never interned become empty symbols, they match no model name
+        static SymbolPath parse(std::string_view path);
+
+        void push(Symbol segment);
+        void pop() noexcept { m_segments.pop_back(); m_hashes.pop_back(); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_segments.size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_segments.empty(); }
+        [[nodiscard]] Symbol back() const noexcept { return m_segments.back(); }
+        [[nodiscard]] Symbol operator[](std::size_t index) const noexcept { return m_segments[index]; }
+        [[nodiscard]] const std::vector<Symbol>& segments() const noexcept { return m_segments; }
+
+        [[nodiscard]] std::uint64_t hash() const noexcept { return prefixHash(size()); }
+        [[nodiscard]] std::uint64_t prefixHash(std::size_t length) const noexcept {
+            return length == 0 ? EMPTY_HASH : m_hashes[length - 1];
+        }
+
+        // Equal prefix of the given length, checked by hash and the last segment only
+        [[nodiscard]] bool sharesPrefix(const SymbolPath& other, std::size_t length) const noexcept {
+            return length <= size() and length <= other.size()
+                   and (length == 0 or (prefixHash(length) == other.prefixHash(length)
+                                        and m_segments[length - 1] == other.m_segments[length - 1]));
+        }
+
+        [[nodiscard]] std::string str() const;
+        [[nodiscard]] std::string str(Symbol last) const;
+    private:
+        static constexpr std::uint64_t EMPTY_HASH = 0xcbf29ce484222325ULL;
+
+        std::vector<Symbol> m_segments;
+        std::vector<std::uint64_t> m_hashes;
+    };
+
+}
+
+template<>
+struct std::hash<arxml::utilities::Symbol> {
+    std::size_t operator()(const arxml::utilities::Symbol& symbol) const noexcept {
+        return std::hash<const void*>{}(symbol.address());
+    }
+};
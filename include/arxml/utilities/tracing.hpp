@@ -0,0 +1,99 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace arxml::utilities::tracing {
+
+    struct TraceEvent {
+        static constexpr std::size_t DETAIL_SIZE = 104;
+
+        const char* name;
+        std::int64_t begin;
+        std::int64_t duration;
+        std::array<char, DETAIL_SIZE> detail;
+    };
+
+    // Single producer ring buffer owned by one thread. Writing never blocks; when the buffer is full
+    // the oldest events are overwritten.
+    class TraceBuffer {
+    public:
+        static constexpr std::size_t CAPACITY = 16384;
+
+        explicit TraceBuffer(int thread_id) : m_thread_id{thread_id}, m_head{0}, m_events{new TraceEvent[CAPACITY]} {}
+
+        void push(const TraceEvent& event) noexcept {
+            auto head = m_head.load(std::memory_order_relaxed);
+            m_events[head % CAPACITY] = event;
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]] int getThreadId() const noexcept { return m_thread_id; }
+        [[nodiscard]] std::uint64_t getWritten() const noexcept { return m_head.load(std::memory_order_acquire); }
+        [[nodiscard]] const TraceEvent& at(std::uint64_t index) const noexcept { return m_events[index % CAPACITY]; }
+    private:
+        int m_thread_id;
+        std::atomic<std::uint64_t> m_head;
+        std::unique_ptr<TraceEvent[]> m_events;
+    };
+
+    class TraceRecorder {
+    public:
+        static TraceRecorder& instance();
+
+        void enable(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+        [[nodiscard]] bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] std::int64_t now() const noexcept;
+        // Allocates buffer of the calling thread; record drops events of threads that never attached
+        void attachThread();
+        void record(const char* name, std::string_view detail, std::int64_t begin, std::int64_t end) noexcept;
+
+        // Writes events in Chrome trace event format; must not run concurrently with recording threads
+        void write(std::ostream& os) const;
+    private:
+        TraceRecorder();
+
+        std::atomic<bool> m_enabled;
+        std::chrono::steady_clock::time_point m_epoch;
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<TraceBuffer>> m_buffers;
+    };
+
+    // Records complete event spanning the scope. Detail is copied when the scope opens with tracing enabled, so
+    // temporaries are fine, and it is truncated when too long.
+    class TraceScope {
+    public:
+        explicit TraceScope(const char* name, std::string_view detail = {});
+        ~TraceScope();
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+    private:
+        const char* m_name;
+        std::array<char, TraceEvent::DETAIL_SIZE> m_detail;
+        std::size_t m_detail_size;
+        std::int64_t m_begin;
+        bool m_active;
+    };
+
+}
+
+#ifdef ARXML_ENABLE_PROFILING
+#define ARXML_TRACE_CONCAT_IMPL(a, b) a##b
+#define ARXML_TRACE_CONCAT(a, b) ARXML_TRACE_CONCAT_IMPL(a, b)
+#define ARXML_TRACE_SCOPE(...) \
+    ::arxml::utilities::tracing::TraceScope ARXML_TRACE_CONCAT(arxml_trace_scope_, __LINE__){__VA_ARGS__}
+#else
+#define ARXML_TRACE_SCOPE(...) do {} while (false)
+#endif
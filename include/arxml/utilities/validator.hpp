@@ -0,0 +1,81 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arxml/utilities/diagnostics.hpp>
+
+namespace arxml::utilities {
+
+    // Checks the basic shape of ARXML files without building the model: AUTOSAR root with a single AR-PACKAGES,
+    // packages and elements with a SHORT-NAME, unique paths of named elements and references to defined paths.
+    // Files are scanned as a stream keeping only the open elements, and may be validated from many threads at once.
+    // Defined paths are remembered by their 64-bit hashes only.
+    class StructureValidator {
+    public:
+        explicit StructureValidator(Diagnostics& diagnostics)
+        : m_diagnostics{diagnostics}
+        , m_files{0}
+        {
+
+        }
+
+        // Decompresses .gz and .zst files on the fly when the library supports them
+        void validateFile(const std::string& filename);
+        void validate(const std::string& unit_name, std::istream& input);
+
+        // Reports duplicate paths and references whose targets were defined in none of the validated files
+        void finish();
+
+        [[nodiscard]] std::size_t files() const noexcept { return m_files; }
+        [[nodiscard]] std::size_t paths() const;
+    private:
+        friend class FileScanner;
+
+        struct Location {
+            const std::string* file;
+            int line;
+            bool package;   // packages may be split across files, only elements have to be unique
+        };
+
+        // Reference to a path, or a duplicate definition of it
+        struct Reference {
+            std::uint64_t target;
+            Location location;
+            std::string text;
+            std::string destination;
+        };
+
+        struct Shard {
+            mutable std::mutex mutex;
+            std::unordered_map<std::uint64_t, Location> paths;
+        };
+
+        const std::string* addFile(const std::string& unit_name);
+        void definePath(const std::string& path, Location location);
+        void checkReference(std::string text, std::string destination, Location location);
+        [[nodiscard]] bool isDefined(std::uint64_t path) const;
+        Shard& shardOf(std::uint64_t path) { return m_shards[path % m_shards.size()]; }
+        [[nodiscard]] const Shard& shardOf(std::uint64_t path) const { return m_shards[path % m_shards.size()]; }
+
+        Diagnostics& m_diagnostics;
+        std::array<Shard, 64> m_shards;
+        std::mutex m_mutex;
+        std::deque<std::string> m_file_names;
+        std::vector<Reference> m_duplicates;
+        std::vector<Reference> m_unresolved;
+        std::atomic<std::size_t> m_files;
+    };
+
+}
@@ -4,12 +4,16 @@
 
 #include "arxml/utilities/arxml_parser.hpp"
 
-#include <cassert>
+#include <stdexcept>
 
 #include <boost/lexical_cast.hpp>
 
 #include <tinyxml2.h>
 
+#include "arxml/helpers/content_hash.hpp"
+#include "arxml/utilities/diagnostics.hpp"
+#include "arxml/utilities/instrumentation.hpp"
+
 namespace arxml::utilities::parser {
 
     namespace {
@@ -29,6 +33,7 @@ namespace arxml::utilities::parser {
         };
 
         static ParsedValue parseElementValue(std::string value) {
+            ARXML_PROFILE_SCOPE(instrumentation::Phase::VALUE_CLASSIFICATION);
             try {
                 auto double_value = boost::lexical_cast<double>(value);
                 auto integer_value = boost::lexical_cast<int>(value);
@@ -45,6 +50,74 @@ namespace arxml::utilities::parser {
         }
     }
 
+    // Position of the parser in the package tree. Packages and elements not covered by the package filter
+    // are recognised by their short names and skipped before anything is built for them.
+    class PackageCursor {
+    public:
+        explicit PackageCursor(const PackageFilter& filter)
+        : m_filter{filter}
+        , m_matches{filter.empty() ? PackageFilter::Match::INSIDE : PackageFilter::Match::ANCESTOR}
+        {
+
+        }
+
+        PackageFilter::Match enter(tinyxml2::XMLElement* element) {
+            m_path.push_back(shortName(element));
+            auto match = isFiltering() ? m_filter.match(m_path) : m_matches.back();
+            m_matches.push_back(match);
+            return match;
+        }
+
+        void leave() {
+            m_path.pop_back();
+            m_matches.pop_back();
+        }
+
+        // Only below packages which are ancestors of some prefix single children have to be checked
+        [[nodiscard]] bool isFiltering() const noexcept { return m_matches.back() == PackageFilter::Match::ANCESTOR; }
+
+        bool covers(tinyxml2::XMLElement* element) {
+            auto match = enter(element);
+            leave();
+            return match != PackageFilter::Match::NONE;
+        }
+    private:
+        static std::string_view shortName(tinyxml2::XMLElement* element) {
+            auto short_name = element->FirstChildElement("SHORT-NAME");
+            return short_name and short_name->GetText() ? short_name->GetText() : std::string_view{};
+        }
+
+        const PackageFilter& m_filter;
+        std::vector<std::string_view> m_path;
+        std::vector<PackageFilter::Match> m_matches;
+    };
+
+    // What every parser of a single unit shares
+    struct ParserContext {
+        IModelComponentFactory& factory;
+        const std::string& unit_name;
+        Diagnostics& diagnostics;
+
+        void report(Severity severity, const tinyxml2::XMLElement* element, std::string message) const {
+            diagnostics.report({severity, unit_name, element ? element->GetLineNum() : 0, std::move(message)});
+        }
+    };
+
+    // Raised for a subtree which cannot be built; the parser of its parent reports it and goes on without it
+    class ParseError : public std::runtime_error {
+    public:
+        ParseError(const tinyxml2::XMLElement* element, const std::string& message)
+        : std::runtime_error(message)
+        , m_element{element}
+        {
+
+        }
+
+        [[nodiscard]] const tinyxml2::XMLElement* getElement() const noexcept { return m_element; }
+    private:
+        const tinyxml2::XMLElement* m_element;
+    };
+
     class ParserLogic;
     class ModelEntryParser;
     class PackageParser;
@@ -56,24 +129,52 @@ namespace arxml::utilities::parser {
 
     class ParserLogic {
     public:
-        explicit ParserLogic(IModelComponentFactory& element_factory)
-        : m_element_factory{element_factory}
+        explicit ParserLogic(ParserContext& context)
+        : m_context{context}
         {}
 
         virtual ~ParserLogic() = default;
 
-        IModelComponentFactory& getComponentFactory() { return m_element_factory; }
+        IModelComponentFactory& getComponentFactory() { return m_context.factory; }
+        ParserContext& getContext() { return m_context; }
 
         virtual void parse(tinyxml2::XMLElement* element) = 0;
+    protected:
+        // Parses a child subtree; when it cannot be built it is reported and false is returned
+        bool parseChild(ParserLogic& parser, tinyxml2::XMLElement* element) {
+            try {
+                parser.parse(element);
+                return true;
+            }
+            catch (const ParseError& error) {
+                m_context.report(Severity::ERROR, error.getElement(),
+                                 std::string(error.what()) + ", " + element->Name() + " skipped");
+                return false;
+            }
+        }
+
+        // Short name of a package or named element, which cannot be built without it
+        const char* requireShortName(tinyxml2::XMLElement* element) {
+            auto short_name = element->FirstChildElement("SHORT-NAME");
+            if (short_name == nullptr or short_name->GetText() == nullptr) {
+                throw ParseError(element, std::string(element->Name()) + " without SHORT-NAME");
+            }
+            if (short_name->NextSiblingElement("SHORT-NAME") != nullptr) {
+                m_context.report(Severity::WARNING, short_name->NextSiblingElement("SHORT-NAME"),
+                                 "repeated SHORT-NAME ignored");
+            }
+            return short_name->GetText();
+        }
     private:
-        IModelComponentFactory& m_element_factory;
+        ParserContext& m_context;
     };
 
     class ModelEntryParser : public ParserLogic {
     public:
-        ModelEntryParser(IModelComponentFactory& element_factory, std::string filename, std::string xmlns,
-                         std::string xmlns_xsi, std::string xmlns_schema_location)
-                : ParserLogic(element_factory)
+        ModelEntryParser(ParserContext& context, const PackageFilter& filter, std::string filename,
+                         std::string xmlns, std::string xmlns_xsi, std::string xmlns_schema_location)
+                : ParserLogic(context)
+                , m_cursor{filter}
                 , m_filename{std::move(filename)}
                 , m_xmlns{std::move(xmlns)}
                 , m_xmlns_xsi{std::move(xmlns_xsi)}
@@ -86,6 +187,7 @@ namespace arxml::utilities::parser {
         std::unique_ptr<model::IModelEntry> getModelUnit() { return std::move(m_product); }
 
     private:
+        PackageCursor m_cursor;
         std::string m_filename;
         std::string m_xmlns;
         std::string m_xmlns_xsi;
@@ -95,8 +197,9 @@ namespace arxml::utilities::parser {
 
     class PackagesParser : public ParserLogic {
     public:
-        explicit PackagesParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        PackagesParser(ParserContext& context, PackageCursor& cursor)
+                : ParserLogic(context)
+                , m_cursor{cursor}
         {
 
         }
@@ -105,14 +208,16 @@ namespace arxml::utilities::parser {
         std::unique_ptr<model::IAutosarPackages> getPackages() { return std::move(m_packages); }
 
     private:
+        PackageCursor& m_cursor;
         std::unique_ptr<model::IAutosarPackages> m_packages;
     };
 
 
     class PackageParser : public ParserLogic {
     public:
-        explicit PackageParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        PackageParser(ParserContext& context, PackageCursor& cursor)
+                : ParserLogic(context)
+                , m_cursor{cursor}
         {
 
         }
@@ -121,13 +226,15 @@ namespace arxml::utilities::parser {
         std::unique_ptr<model::IAutosarPackage> getPackage() { return std::move(m_package); }
 
     private:
+        PackageCursor& m_cursor;
         std::unique_ptr<model::IAutosarPackage> m_package;
     };
 
     class ElementsParser : public ParserLogic {
     public:
-        explicit ElementsParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        ElementsParser(ParserContext& context, PackageCursor& cursor)
+                : ParserLogic(context)
+                , m_cursor{cursor}
         {
 
         }
@@ -136,13 +243,14 @@ namespace arxml::utilities::parser {
         std::unique_ptr<model::IAutosarElements> getElements() { return std::move(m_elements); }
 
     private:
+        PackageCursor& m_cursor;
         std::unique_ptr<model::IAutosarElements> m_elements;
     };
 
     class NamedElementParser : public ParserLogic {
     public:
-        explicit NamedElementParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        explicit NamedElementParser(ParserContext& context)
+                : ParserLogic(context)
         {
 
         }
@@ -156,8 +264,8 @@ namespace arxml::utilities::parser {
 
     class CompositeElementParser : public ParserLogic {
     public:
-        explicit CompositeElementParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        explicit CompositeElementParser(ParserContext& context)
+                : ParserLogic(context)
         {
 
         }
@@ -171,8 +279,8 @@ namespace arxml::utilities::parser {
 
     class SimpleElementParser : public ParserLogic {
     public:
-        explicit SimpleElementParser(IModelComponentFactory& element_factory)
-                : ParserLogic(element_factory)
+        explicit SimpleElementParser(ParserContext& context)
+                : ParserLogic(context)
         {
 
         }
@@ -185,75 +293,98 @@ namespace arxml::utilities::parser {
     };
 
     void ModelEntryParser::parse(tinyxml2::XMLElement* element) {
-        assert(element->Name() == std::string("AR-PACKAGES"));
         m_product = getComponentFactory().createModelEntry(m_filename, m_xmlns, m_xmlns_xsi, m_xmlns_schema_location);
-        auto it = element->FirstChildElement("AR-PACKAGE");
+        auto it = element->FirstChildElement();
         while (it != nullptr) {
-            PackageParser parser{getComponentFactory()};
-            parser.parse(it);
-            auto result = parser.getPackage();
-            assert(result != nullptr);
-            m_product->addPackage(std::move(result));
+            PackageParser parser{getContext(), m_cursor};
+            if (parseChild(parser, it)) {
+                if (auto result = parser.getPackage()) {
+                    m_product->addPackage(std::move(result));
+                }
+            }
             it = it->NextSiblingElement();
         }
     }
 
     void PackagesParser::parse(tinyxml2::XMLElement* element) {
         m_packages = getComponentFactory().createPackages();
-        assert(element->Name() == std::string("AR-PACKAGES"));
-        auto it = element->FirstChildElement("AR-PACKAGE");
+        auto it = element->FirstChildElement();
         while (it != nullptr) {
-            PackageParser parser{getComponentFactory()};
-            parser.parse(it);
-            m_packages->addPackage(parser.getPackage());
+            PackageParser parser{getContext(), m_cursor};
+            if (parseChild(parser, it)) {
+                if (auto result = parser.getPackage()) {
+                    m_packages->addPackage(std::move(result));
+                }
+            }
             it = it->NextSiblingElement();
         }
     }
 
     void PackageParser::parse(tinyxml2::XMLElement* element) {
-        assert(element->Name() == std::string("AR-PACKAGE"));
-        auto short_name = element->FirstChildElement("SHORT-NAME");
-        assert(short_name->NextSiblingElement("SHORT-NAME") == nullptr);
+        if (element->Name() != std::string_view("AR-PACKAGE")) {
+            throw ParseError(element, std::string("unexpected ") + element->Name() + " in AR-PACKAGES");
+        }
+        ARXML_PROFILE_COUNT(instrumentation::Counter::PACKAGES, 1);
+        auto short_name = requireShortName(element);
 
         auto packages = element->FirstChildElement("AR-PACKAGES");
         auto elements = element->FirstChildElement("ELEMENTS");
+        if (packages and elements) {
+            getContext().report(Severity::WARNING, elements, "ELEMENTS next to AR-PACKAGES ignored");
+        }
+        else if (not packages and not elements) {
+            getContext().report(Severity::WARNING, element, "AR-PACKAGE without AR-PACKAGES or ELEMENTS");
+        }
 
+        // Packages leading to a prefix are dropped when nothing below them is covered
+        auto match = m_cursor.enter(element);
+        if (match == PackageFilter::Match::NONE) {
+            m_cursor.leave();
+            return;
+        }
         if (packages) {
-            assert (packages->NextSiblingElement() == nullptr);
-            PackagesParser parser(getComponentFactory());
+            PackagesParser parser(getContext(), m_cursor);
             parser.parse(packages);
-            m_package = getComponentFactory().createPackage(short_name->GetText(), parser.getPackages());
+            auto result = parser.getPackages();
+            if (match == PackageFilter::Match::INSIDE or not result->getPackages().empty()) {
+                m_package = getComponentFactory().createPackage(short_name, std::move(result));
+            }
         }
         else if (elements) {
-            assert (elements->NextSiblingElement() == nullptr);
-            ElementsParser parser(getComponentFactory());
+            ElementsParser parser(getContext(), m_cursor);
             parser.parse(elements);
-            m_package = getComponentFactory().createPackage(short_name->GetText(), parser.getElements());
+            auto result = parser.getElements();
+            if (match == PackageFilter::Match::INSIDE or not result->getElements().empty()) {
+                m_package = getComponentFactory().createPackage(short_name, std::move(result));
+            }
         }
-        else {
-            assert(1 == 0); // INVALID BRANCH
+        else if (match == PackageFilter::Match::INSIDE) {
+            m_package = getComponentFactory().createPackage(short_name, getComponentFactory().createElements());
         }
+        m_cursor.leave();
     }
 
     void ElementsParser::parse(tinyxml2::XMLElement *element) {
-        assert(element->Name() == std::string("ELEMENTS"));
         m_elements = getComponentFactory().createElements();
 
+        auto filtering = m_cursor.isFiltering();
         auto it = element->FirstChildElement();
         while (it != nullptr) {
-            NamedElementParser named_element_parser(getComponentFactory());
-            named_element_parser.parse(it);
-            m_elements->addElement(named_element_parser.getNamedElement());
+            if (filtering and not m_cursor.covers(it)) {
+                it = it->NextSiblingElement();
+                continue;
+            }
+            NamedElementParser named_element_parser(getContext());
+            if (parseChild(named_element_parser, it)) {
+                m_elements->addElement(named_element_parser.getNamedElement());
+            }
             it = it->NextSiblingElement();
         }
     }
 
     void NamedElementParser::parse(tinyxml2::XMLElement* element) {
-        auto short_name = element->FirstChildElement("SHORT-NAME");
-
-        assert(short_name->NextSiblingElement("SHORT-NAME") == nullptr);
-
-        m_element = getComponentFactory().createNamedCompositeElement(element->Name(), short_name->GetText());
+        ARXML_PROFILE_COUNT(instrumentation::Counter::NAMED_ELEMENTS, 1);
+        m_element = getComponentFactory().createNamedCompositeElement(element->Name(), requireShortName(element));
 
         auto it = element->FirstChildElement();
         while (it != nullptr) {
@@ -262,51 +393,59 @@ namespace arxml::utilities::parser {
                 continue;
             }
             if (not it->GetText() and it->FirstChildElement("SHORT-NAME")) {
-                NamedElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getNamedElement());
+                NamedElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getNamedElement());
+                }
             }
             else if (not it->GetText()) {
-                CompositeElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getCompositeElement());
+                CompositeElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getCompositeElement());
+                }
             }
             else {
-                SimpleElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getSimpleElement());
+                SimpleElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getSimpleElement());
+                }
             }
             it = it->NextSiblingElement();
         }
     }
 
     void CompositeElementParser::parse(tinyxml2::XMLElement* element) {
+        ARXML_PROFILE_COUNT(instrumentation::Counter::COMPOSITE_ELEMENTS, 1);
         m_element = getComponentFactory().createCompositeElement(element->Name());
 
         auto it = element->FirstChildElement();
         while (it != nullptr) {
             if (not it->GetText() and it->FirstChildElement("SHORT-NAME")) {
-                NamedElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getNamedElement());
+                NamedElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getNamedElement());
+                }
             }
             else if (not it->GetText()) {
-                CompositeElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getCompositeElement());
+                CompositeElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getCompositeElement());
+                }
             }
             else {
-                SimpleElementParser parser(getComponentFactory());
-                parser.parse(it);
-                m_element->addSubElement(parser.getSimpleElement());
+                SimpleElementParser parser(getContext());
+                if (parseChild(parser, it)) {
+                    m_element->addSubElement(parser.getSimpleElement());
+                }
             }
             it = it->NextSiblingElement();
         }
     }
 
     void SimpleElementParser::parse(tinyxml2::XMLElement* element) {
+        ARXML_PROFILE_COUNT(instrumentation::Counter::SIMPLE_ELEMENTS, 1);
         auto tag_name = element->Name();
-        std::string value{element->GetText()};
+        std::string value{element->GetText() ? element->GetText() : ""};
 
         auto parsing_value = parseElementValue(value);
         switch(parsing_value.type) {
@@ -318,8 +457,15 @@ namespace arxml::utilities::parser {
                 m_element = getComponentFactory().createNumberElement(tag_name, std::get<int>(parsing_value.value));
                 break;
             }
-            default:
-                m_element = getComponentFactory().createStringElement(tag_name, std::move(value));
+            default: {
+                auto destination = element->Attribute("DEST");
+                if (destination != nullptr) {
+                    m_element = getComponentFactory().createReferenceElement(tag_name, std::move(value), destination);
+                }
+                else {
+                    m_element = getComponentFactory().createStringElement(tag_name, std::move(value));
+                }
+            }
         }
         auto attribute_it = element->FirstAttribute();
         while(attribute_it != nullptr) {
@@ -330,26 +476,78 @@ namespace arxml::utilities::parser {
 
 
     void ArxmlFileParser::parseSource(const std::string& unit_name, utilities::io::IInputSource& source) {
+        ARXML_PROFILE_UNIT(unit_name);
+        addEntry(unit_name, buildEntry(unit_name, source));
+    }
+
+    std::unique_ptr<model::IModelEntry> ArxmlFileParser::parseEntry(const std::string& unit_name,
+                                                                    utilities::io::IInputSource& source) const {
+        ARXML_PROFILE_UNIT(unit_name);
+        return buildEntry(unit_name, source);
+    }
+
+    void ArxmlFileParser::addEntry(const std::string& unit_name, std::unique_ptr<model::IModelEntry> entry) {
+        if (not entry) {
+            return;
+        }
+        ARXML_PROFILE_SCOPE(instrumentation::Phase::REGISTRATION);
         if (not m_root) {
             m_root = std::move(m_element_factory.createRoot());
         }
+        m_root->registerModelEntry(unit_name, std::move(entry));
+    }
 
+    std::unique_ptr<model::IModelEntry> ArxmlFileParser::buildEntry(const std::string& unit_name,
+                                                                    utilities::io::IInputSource& source) const {
+        ParserContext context{m_element_factory, unit_name, *m_diagnostics};
+        std::string content;
+        try {
+            content = source.getContent();
+        }
+        catch (const std::runtime_error& error) {
+            context.report(Severity::ERROR, nullptr, std::string(error.what()) + ", file skipped");
+            return nullptr;
+        }
         tinyxml2::XMLDocument xml;
-        xml.Parse(source.getContent().c_str());
-
-        // TODO: Check if all attributes are available
-        assert(xml.RootElement()->Attribute("xmlns") != nullptr
-               and xml.RootElement()->Attribute("xmlns:xsi") != nullptr
-               and xml.RootElement()->Attribute("xsi:schemaLocation") != nullptr);
-
-        ModelEntryParser model_unit_parser(m_element_factory, unit_name, xml.RootElement()->Attribute("xmlns"),
-                                          xml.RootElement()->Attribute("xmlns:xsi"),
-                                          xml.RootElement()->Attribute("xsi:schemaLocation"));
-        assert(xml.RootElement() != nullptr);
-        assert(xml.RootElement()->FirstChildElement("AR-PACKAGES") != nullptr);
-        assert(xml.RootElement()->FirstChildElement("AR-PACKAGES")->NextSiblingElement() == nullptr);
-        model_unit_parser.parse(xml.RootElement()->FirstChildElement("AR-PACKAGES"));
-        m_root->registerModelEntry(unit_name, std::move(model_unit_parser.getModelUnit()));
+        {
+            ARXML_PROFILE_SCOPE(instrumentation::Phase::XML_PARSING);
+            xml.Parse(content.c_str(), content.size());
+        }
+        if (xml.Error()) {
+            m_diagnostics->report({Severity::ERROR, unit_name, xml.ErrorLineNum(),
+                                   std::string("malformed XML: ") + xml.ErrorStr() + ", file skipped"});
+            return nullptr;
+        }
+
+        auto root = xml.RootElement();
+        auto packages = root->FirstChildElement("AR-PACKAGES");
+        if (packages == nullptr) {
+            context.report(Severity::ERROR, root, std::string(root->Name()) + " without AR-PACKAGES, file skipped");
+            return nullptr;
+        }
+        if (auto next = packages->NextSiblingElement()) {
+            context.report(Severity::WARNING, next, std::string(next->Name()) + " after AR-PACKAGES ignored");
+        }
+        auto attribute = [&context, root](const char* name) {
+            if (auto value = root->Attribute(name)) {
+                return std::string(value);
+            }
+            context.report(Severity::WARNING, root, std::string("missing ") + name + " attribute");
+            return std::string();
+        };
+
+        ModelEntryParser model_unit_parser(context, m_package_filter, unit_name, attribute("xmlns"),
+                                           attribute("xmlns:xsi"), attribute("xsi:schemaLocation"));
+        {
+            ARXML_PROFILE_SCOPE(instrumentation::Phase::MODEL_BUILDING);
+            model_unit_parser.parse(packages);
+        }
+        auto model_unit = model_unit_parser.getModelUnit();
+        if (m_content_hashing) {
+            ARXML_PROFILE_SCOPE(instrumentation::Phase::CONTENT_HASHING);
+            helpers::annotate_content_hashes(*model_unit);
+        }
+        return model_unit;
     }
 
 }
@@ -0,0 +1,337 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/columnar.hpp>
+
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <arxml/dfs/traversal.hpp>
+
+namespace arxml::helpers {
+
+    namespace {
+        class TableCollector : public dfs::TraversalCallback {
+        public:
+            explicit TableCollector(ModelTables& tables)
+            : m_tables{tables}
+            {
+
+            }
+
+            dfs::VisitResult visit(const model::IModelEntry& root) override {
+                m_file = root.getEntryName();
+                return dfs::VisitResult::CONTINUE;
+            }
+
+            dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+                m_paths.push_back(m_paths.back() + "/" + package.getName());
+                return dfs::VisitResult::CONTINUE;
+            }
+
+            void close(const model::IAutosarPackage& package) override {
+                m_paths.pop_back();
+            }
+
+            dfs::VisitResult visit(const model::IAutosarElement& element) override {
+                switch (element.getType()) {
+                    case model::EntryType::NAMED_ELEMENT: {
+                        auto name = dynamic_cast<const model::INamedAutosarElement&>(element).getNameId().view();
+                        auto path = m_paths.back() + "/";
+                        path.append(name);
+                        m_tables.elements.addRow({path, element.getTagId().view(), m_paths.back(), m_file});
+                        m_paths.push_back(std::move(path));
+                        break;
+                    }
+                    case model::EntryType::REFERENCE_ELEMENT: {
+                        auto& reference = dynamic_cast<const model::IReferenceAutosarElement&>(element);
+                        m_tables.references.addRow({m_paths.back(), reference.getDestination().view(), reference.getText()});
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                return dfs::VisitResult::CONTINUE;
+            }
+
+            void close(const model::IAutosarElement& element) override {
+                if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                    m_paths.pop_back();
+                }
+            }
+        private:
+            ModelTables& m_tables;
+            std::string m_file;
+            std::vector<std::string> m_paths{""};
+        };
+
+        void write_csv_value(std::ostream& os, std::string_view value) {
+            if (value.find_first_of(",\"\r\n") == std::string_view::npos) {
+                os << value;
+                return;
+            }
+            os << '"';
+            for (auto character: value) {
+                if (character == '"') {
+                    os << '"';
+                }
+                os << character;
+            }
+            os << '"';
+        }
+
+        // Minimal flatbuffer writer for Arrow IPC metadata. Objects are laid out front to back: a table is
+        // written before the objects it refers to, so every offset points forward as the format requires.
+        class FlatBufferWriter {
+        public:
+            struct TableLayout {
+                std::size_t position;
+                std::vector<std::size_t> fields;    // position of every field, 0 when absent
+            };
+
+            FlatBufferWriter() {
+                allocate(sizeof(std::uint32_t), sizeof(std::uint32_t)); // root offset
+            }
+
+            // The skew lets the bytes following a length prefix meet the alignment
+            std::size_t allocate(std::size_t size, std::size_t alignment, std::size_t skew = 0) {
+                while ((m_bytes.size() + skew) % alignment != 0) {
+                    m_bytes.push_back('\0');
+                }
+                auto position = m_bytes.size();
+                m_bytes.resize(position + size, '\0');
+                return position;
+            }
+
+            template<class T>
+            void store(std::size_t position, T value) {
+                std::memcpy(m_bytes.data() + position, &value, sizeof(T));
+            }
+
+            void link(std::size_t field, std::size_t target) {
+                store(field, static_cast<std::uint32_t>(target - field));
+            }
+
+            void root(std::size_t table) {
+                link(0, table);
+            }
+
+            // Field sizes are indexed by field id, 0 marks an absent field
+            TableLayout table(const std::vector<std::size_t>& sizes) {
+                std::vector<std::uint16_t> offsets(sizes.size(), 0);
+                std::size_t inline_size = sizeof(std::int32_t);
+                for (std::size_t size: {8, 4, 2, 1}) {
+                    for (std::size_t id = 0; id < sizes.size(); ++id) {
+                        if (sizes[id] == size) {
+                            inline_size = (inline_size + size - 1) / size * size;
+                            offsets[id] = static_cast<std::uint16_t>(inline_size);
+                            inline_size += size;
+                        }
+                    }
+                }
+                auto vtable_size = sizeof(std::uint16_t) * (2 + sizes.size());
+                auto vtable = allocate(vtable_size, sizeof(std::uint16_t));
+                auto position = allocate(inline_size, sizeof(std::uint64_t));
+                store(vtable, static_cast<std::uint16_t>(vtable_size));
+                store(vtable + 2, static_cast<std::uint16_t>(inline_size));
+                TableLayout layout{position, std::vector<std::size_t>(sizes.size(), 0)};
+                for (std::size_t id = 0; id < sizes.size(); ++id) {
+                    store(vtable + 4 + 2 * id, offsets[id]);
+                    if (offsets[id] != 0) {
+                        layout.fields[id] = position + offsets[id];
+                    }
+                }
+                store(position, static_cast<std::int32_t>(position - vtable));
+                return layout;
+            }
+
+            std::size_t string(std::string_view value) {
+                auto position = allocate(sizeof(std::uint32_t) + value.size() + 1, sizeof(std::uint32_t));
+                store(position, static_cast<std::uint32_t>(value.size()));
+                std::memcpy(m_bytes.data() + position + sizeof(std::uint32_t), value.data(), value.size());
+                return position;
+            }
+
+            // Returns position of the length prefix, elements follow it
+            std::size_t vector(std::size_t count, std::size_t element_size, std::size_t alignment) {
+                auto position = allocate(sizeof(std::uint32_t) + count * element_size, alignment, sizeof(std::uint32_t));
+                store(position, static_cast<std::uint32_t>(count));
+                return position;
+            }
+
+            [[nodiscard]] const std::string& bytes() const noexcept { return m_bytes; }
+        private:
+            std::string m_bytes;
+        };
+
+        static_assert(std::endian::native == std::endian::little, "Arrow buffers are written in host byte order");
+
+        // Identifiers from the Arrow format definition (Schema.fbs, Message.fbs)
+        constexpr std::int16_t METADATA_V5 = 4;
+        constexpr std::uint8_t HEADER_SCHEMA = 1;
+        constexpr std::uint8_t HEADER_RECORD_BATCH = 3;
+        constexpr std::uint8_t TYPE_UTF8 = 5;
+        constexpr std::uint32_t CONTINUATION = 0xFFFFFFFF;
+        constexpr std::size_t ARROW_ALIGNMENT = 8;
+
+        std::size_t padded(std::size_t size) {
+            return (size + ARROW_ALIGNMENT - 1) / ARROW_ALIGNMENT * ARROW_ALIGNMENT;
+        }
+
+        // Message table: version, header type, header, body length
+        std::size_t message(FlatBufferWriter& writer, std::uint8_t header_type, std::int64_t body_length) {
+            auto layout = writer.table({2, 1, 4, 8});
+            writer.root(layout.position);
+            writer.store(layout.fields[0], METADATA_V5);
+            writer.store(layout.fields[1], header_type);
+            writer.store(layout.fields[3], body_length);
+            return layout.fields[2];
+        }
+
+        std::string schema(const Table& table) {
+            FlatBufferWriter writer;
+            auto header = message(writer, HEADER_SCHEMA, 0);
+            // Schema: endianness, fields
+            auto schema = writer.table({2, 4});
+            writer.link(header, schema.position);
+            const auto& columns = table.getColumns();
+            auto fields = writer.vector(columns.size(), sizeof(std::uint32_t), sizeof(std::uint32_t));
+            writer.link(schema.fields[1], fields);
+            for (std::size_t it = 0; it < columns.size(); ++it) {
+                // Field: name, nullable, type type, type, dictionary, children
+                auto field = writer.table({4, 1, 1, 4, 0, 4});
+                writer.link(fields + sizeof(std::uint32_t) * (it + 1), field.position);
+                writer.store(field.fields[2], TYPE_UTF8);
+                writer.link(field.fields[0], writer.string(columns[it].getName()));
+                writer.link(field.fields[3], writer.table({}).position);
+                writer.link(field.fields[5], writer.vector(0, sizeof(std::uint32_t), sizeof(std::uint32_t)));
+            }
+            return writer.bytes();
+        }
+
+        std::string record_batch(const Table& table, std::vector<std::pair<const void*, std::size_t>>& buffers) {
+            const auto& columns = table.getColumns();
+            std::int64_t body_length = 0;
+            std::vector<std::pair<std::int64_t, std::int64_t>> locations;
+            for (const auto& column: columns) {
+                auto offsets_size = column.getOffsets().size() * sizeof(std::int32_t);
+                locations.emplace_back(body_length, 0);    // validity bitmap is omitted, nothing is null
+                buffers.emplace_back(column.getOffsets().data(), offsets_size);
+                locations.emplace_back(body_length, offsets_size);
+                body_length += static_cast<std::int64_t>(padded(offsets_size));
+                buffers.emplace_back(column.getData().data(), column.getData().size());
+                locations.emplace_back(body_length, column.getData().size());
+                body_length += static_cast<std::int64_t>(padded(column.getData().size()));
+            }
+
+            FlatBufferWriter writer;
+            auto header = message(writer, HEADER_RECORD_BATCH, body_length);
+            // RecordBatch: length, nodes, buffers
+            auto batch = writer.table({8, 4, 4});
+            writer.link(header, batch.position);
+            writer.store(batch.fields[0], static_cast<std::int64_t>(table.rows()));
+            constexpr std::size_t STRUCT_SIZE = 2 * sizeof(std::int64_t);
+            auto nodes = writer.vector(columns.size(), STRUCT_SIZE, sizeof(std::int64_t));
+            writer.link(batch.fields[1], nodes);
+            for (std::size_t it = 0; it < columns.size(); ++it) {
+                auto node = nodes + sizeof(std::uint32_t) + it * STRUCT_SIZE;
+                writer.store(node, static_cast<std::int64_t>(table.rows()));
+                writer.store(node + sizeof(std::int64_t), std::int64_t{0});
+            }
+            auto buffer_list = writer.vector(locations.size(), STRUCT_SIZE, sizeof(std::int64_t));
+            writer.link(batch.fields[2], buffer_list);
+            for (std::size_t it = 0; it < locations.size(); ++it) {
+                auto buffer = buffer_list + sizeof(std::uint32_t) + it * STRUCT_SIZE;
+                writer.store(buffer, locations[it].first);
+                writer.store(buffer + sizeof(std::int64_t), locations[it].second);
+            }
+            return writer.bytes();
+        }
+
+        void write_padding(std::ostream& os, std::size_t size) {
+            static constexpr char ZEROS[ARROW_ALIGNMENT] = {};
+            os.write(ZEROS, static_cast<std::streamsize>(padded(size) - size));
+        }
+
+        void write_message(std::ostream& os, const std::string& metadata) {
+            auto length = static_cast<std::int32_t>(padded(metadata.size()));
+            os.write(reinterpret_cast<const char*>(&CONTINUATION), sizeof(CONTINUATION));
+            os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            os.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+            write_padding(os, metadata.size());
+        }
+    }
+
+    StringColumn::StringColumn(std::string name)
+    : m_name{std::move(name)}
+    , m_offsets{0}
+    {
+
+    }
+
+    void StringColumn::append(std::string_view value) {
+        if (m_data.size() + value.size() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+            throw std::length_error("Column " + m_name + " exceeds 2 GiB of text");
+        }
+        m_data.append(value);
+        m_offsets.push_back(static_cast<std::int32_t>(m_data.size()));
+    }
+
+    Table::Table(std::initializer_list<std::string> column_names)
+    {
+        for (const auto& name: column_names) {
+            m_columns.emplace_back(name);
+        }
+    }
+
+    void Table::addRow(std::initializer_list<std::string_view> values) {
+        if (values.size() != m_columns.size()) {
+            throw std::invalid_argument("Row has " + std::to_string(values.size()) + " values, table has "
+                                        + std::to_string(m_columns.size()) + " columns");
+        }
+        auto column = m_columns.begin();
+        for (auto value: values) {
+            (column++)->append(value);
+        }
+    }
+
+    ModelTables tabulate_model(const model::IAutosarModel& model) {
+        ModelTables tables{Table{"path", "tag", "parent", "file"}, Table{"source", "dest", "target"}};
+        TableCollector collector(tables);
+        dfs::traverse_model(model, collector);
+        return tables;
+    }
+
+    void write_csv(std::ostream& os, const Table& table) {
+        const auto& columns = table.getColumns();
+        for (std::size_t it = 0; it < columns.size(); ++it) {
+            os << (it == 0 ? "" : ",");
+            write_csv_value(os, columns[it].getName());
+        }
+        os << "\n";
+        for (std::size_t row = 0; row < table.rows(); ++row) {
+            for (std::size_t it = 0; it < columns.size(); ++it) {
+                os << (it == 0 ? "" : ",");
+                write_csv_value(os, columns[it][row]);
+            }
+            os << "\n";
+        }
+    }
+
+    void write_arrow_ipc(std::ostream& os, const Table& table) {
+        write_message(os, schema(table));
+        std::vector<std::pair<const void*, std::size_t>> buffers;
+        write_message(os, record_batch(table, buffers));
+        for (const auto& [data, size]: buffers) {
+            os.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            write_padding(os, size);
+        }
+        std::int32_t end_of_stream = 0;
+        os.write(reinterpret_cast<const char*>(&CONTINUATION), sizeof(CONTINUATION));
+        os.write(reinterpret_cast<const char*>(&end_of_stream), sizeof(end_of_stream));
+    }
+
+}
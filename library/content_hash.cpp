@@ -0,0 +1,142 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/content_hash.hpp>
+
+#include <bit>
+
+namespace arxml::helpers {
+
+    namespace {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+        constexpr std::uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+        // References are strings with a DEST attribute, which is hashed anyway; keep hashes independent
+        // of that classification
+        std::uint64_t hashedType(const model::IAutosarElement& element) {
+            auto type = element.getType();
+            return static_cast<std::uint64_t>(type == model::EntryType::REFERENCE_ELEMENT ? model::EntryType::STRING_ELEMENT : type);
+        }
+
+        std::uint64_t hashHeader(const model::IAutosarElement& element) {
+            auto hash = hash_combine(hash_string(element.getTag()), hashedType(element));
+            if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                hash = hash_combine(hash, hash_string(dynamic_cast<const model::INamedAutosarElement&>(element).getName()));
+            }
+            return hash;
+        }
+
+        std::uint64_t hashSimple(const model::ISimpleAutosarElement& element) {
+            auto hash = hashHeader(element);
+            switch (element.getType()) {
+                case model::EntryType::INTEGER_ELEMENT: {
+                    auto value = dynamic_cast<const model::INumberAutosarElement&>(element).getInteger();
+                    hash = hash_combine(hash, static_cast<std::uint64_t>(value));
+                    break;
+                }
+                case model::EntryType::FLOATING_ELEMENT: {
+                    auto value = dynamic_cast<const model::INumberAutosarElement&>(element).getFloating();
+                    hash = hash_combine(hash, std::bit_cast<std::uint64_t>(value));
+                    break;
+                }
+                case model::EntryType::STRING_ELEMENT:
+                case model::EntryType::REFERENCE_ELEMENT: {
+                    hash = hash_combine(hash, hash_string(dynamic_cast<const model::IStringAutosarElement&>(element).getText()));
+                    break;
+                }
+                default:
+                    return hash; // INVALID BRANCH
+            }
+            for (const auto& [name, value]: element.getAttributes()) {
+                hash = hash_combine(hash_combine(hash, hash_string(name)), hash_string(value));
+            }
+            return hash;
+        }
+
+        // Read-only hashing, named elements contribute their stored hash
+        std::uint64_t hashElement(const model::IAutosarElement& element) {
+            if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                return dynamic_cast<const model::INamedAutosarElement&>(element).getContentHash();
+            }
+            if (not element.isComposite()) {
+                return hashSimple(dynamic_cast<const model::ISimpleAutosarElement&>(element));
+            }
+            auto hash = hashHeader(element);
+            for (const auto& child: dynamic_cast<const model::ICompositeAutosarElement&>(element).getSubElements()) {
+                hash = hash_combine(hash, hashElement(child));
+            }
+            return hash;
+        }
+    }
+
+    std::uint64_t hash_string(std::string_view value) {
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (auto character: value) {
+            hash ^= static_cast<unsigned char>(character);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    std::uint64_t annotate_content_hashes(model::IAutosarModel& model) {
+        auto hash = hash_string("AUTOSAR");
+        for (auto& [name, entry]: model.getModelUnits()) {
+            hash = hash_combine(hash, annotate_content_hashes(*entry));
+        }
+        return hash;
+    }
+
+    std::uint64_t annotate_content_hashes(model::IModelEntry& entry) {
+        auto hash = hash_string("AR-PACKAGES");
+        for (auto& package: entry.getPackages()) {
+            hash = hash_combine(hash, annotate_content_hashes(*package));
+        }
+        return hash;
+    }
+
+    std::uint64_t annotate_content_hashes(model::IAutosarPackage& package) {
+        auto hash = hash_combine(hash_string("AR-PACKAGE"), hash_string(package.getName()));
+        switch (package.getCollectionType()) {
+            case model::CollectionType::ELEMENTS_COLLECTION: {
+                for (auto& element: package.getElements().getElements()) {
+                    hash = hash_combine(hash, annotate_content_hashes(*element));
+                }
+                break;
+            }
+            case model::CollectionType::PACKAGES_COLLECTION: {
+                for (auto& subpackage: package.getPackages().getPackages()) {
+                    hash = hash_combine(hash, annotate_content_hashes(*subpackage));
+                }
+                break;
+            }
+            default:
+                break; // INVALID BRANCH
+        }
+        package.setContentHash(hash);
+        return hash;
+    }
+
+    std::uint64_t annotate_content_hashes(model::IAutosarElement& element) {
+        if (not element.isComposite()) {
+            return hashSimple(dynamic_cast<const model::ISimpleAutosarElement&>(element));
+        }
+        auto hash = hashHeader(element);
+        for (auto& child: dynamic_cast<model::ICompositeAutosarElement&>(element).getSubElements()) {
+            hash = hash_combine(hash, annotate_content_hashes(*child));
+        }
+        if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+            dynamic_cast<model::INamedAutosarElement&>(element).setContentHash(hash);
+        }
+        return hash;
+    }
+
+    std::uint64_t content_hash(const model::IAutosarElement& element) {
+        return hashElement(element);
+    }
+
+}
@@ -0,0 +1,55 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/diagnostics.hpp>
+
+#include <algorithm>
+#include <tuple>
+
+namespace arxml::utilities {
+
+    std::ostream& operator<<(std::ostream& os, const Diagnostic& diagnostic) {
+        os << diagnostic.file;
+        if (diagnostic.line > 0) {
+            os << ":" << diagnostic.line;
+        }
+        return os << ": " << (diagnostic.severity == Severity::ERROR ? "error" : "warning") << ": "
+                  << diagnostic.message;
+    }
+
+    Diagnostics& Diagnostics::instance() {
+        static Diagnostics diagnostics;
+        return diagnostics;
+    }
+
+    void Diagnostics::report(Diagnostic diagnostic) {
+        std::lock_guard lock(m_mutex);
+        m_diagnostics.push_back(std::move(diagnostic));
+    }
+
+    void Diagnostics::clear() {
+        std::lock_guard lock(m_mutex);
+        m_diagnostics.clear();
+    }
+
+    std::vector<Diagnostic> Diagnostics::get() const {
+        std::vector<Diagnostic> result;
+        {
+            std::lock_guard lock(m_mutex);
+            result = m_diagnostics;
+        }
+        std::stable_sort(result.begin(), result.end(), [](const Diagnostic& lhs, const Diagnostic& rhs) {
+            return std::tie(lhs.file, lhs.line) < std::tie(rhs.file, rhs.line);
+        });
+        return result;
+    }
+
+    std::size_t Diagnostics::count(Severity severity) const {
+        std::lock_guard lock(m_mutex);
+        return std::count_if(m_diagnostics.begin(), m_diagnostics.end(), [severity](const Diagnostic& diagnostic) {
+            return diagnostic.severity == severity;
+        });
+    }
+
+}
@@ -0,0 +1,184 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/diff.hpp>
+
+#include <algorithm>
+#include <future>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/values.hpp>
+#include <arxml/utilities/parser_facade.hpp>
+
+namespace arxml::helpers {
+
+    namespace {
+        class PathIndexer : public dfs::TraversalCallback {
+        public:
+            explicit PathIndexer(std::unordered_map<std::string, const model::INamedAutosarElement*>& index)
+            : m_index{index}
+            {
+
+            }
+
+            dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+                m_path.append("/").append(package.getName());
+                return dfs::VisitResult::CONTINUE;
+            }
+            void close(const model::IAutosarPackage& package) override { m_path.erase(m_path.rfind('/')); }
+            dfs::VisitResult visit(const model::IAutosarElements& elements) override {
+                for (auto& element: elements.getElements()) {
+                    m_index.emplace(m_path + "/" + element.getName(), &element);
+                }
+                return dfs::VisitResult::SKIP_CHILDREN;
+            }
+        private:
+            std::unordered_map<std::string, const model::INamedAutosarElement*>& m_index;
+            std::string m_path;
+        };
+
+        void buildIndex(const model::IAutosarModel& model,
+                        std::unordered_map<std::string, const model::INamedAutosarElement*>& index) {
+            PathIndexer indexer(index);
+            dfs::traverse_model(model, indexer);
+        }
+
+        std::string childPath(const std::string& path, const model::IAutosarElement& child,
+                              std::unordered_map<std::string, int>& occurrences) {
+            if (child.getType() == model::EntryType::NAMED_ELEMENT) {
+                return path + "/" + dynamic_cast<const model::INamedAutosarElement&>(child).getName();
+            }
+            auto tag = child.getTag();
+            auto occurrence = ++occurrences[tag];
+            if (occurrence == 1) {
+                return path + "/" + tag;
+            }
+            return path + "/" + tag + "[" + std::to_string(occurrence) + "]";
+        }
+    }
+
+    ModelComparator::ModelComparator(const model::IAutosarModel& lhs, const model::IAutosarModel& rhs)
+    : m_lhs{lhs}
+    , m_rhs{rhs}
+    , m_hashed{true}
+    {
+        auto rhs_indexing = std::async(std::launch::async, [this]() {
+            buildIndex(m_rhs, m_rhs_index);
+        });
+        buildIndex(m_lhs, m_lhs_index);
+        rhs_indexing.get();
+        // Stored hashes are 0 until annotate_content_hashes ran; comparing them would hide every change
+        for (const auto* index: {&m_lhs_index, &m_rhs_index}) {
+            m_hashed = m_hashed and std::all_of(index->begin(), index->end(), [](const auto& entry) {
+                return entry.second->getContentHash() != 0;
+            });
+        }
+    }
+
+    std::vector<ModelDifference> ModelComparator::compare() {
+        m_result.clear();
+        for (auto& [path, element]: m_lhs_index) {
+            auto found = m_rhs_index.find(path);
+            if (found == m_rhs_index.end()) {
+                m_result.push_back({DifferenceKind::REMOVED, path, element->getTag()});
+                continue;
+            }
+            compareElements(path, *element, *found->second);
+        }
+        for (auto& [path, element]: m_rhs_index) {
+            if (not m_lhs_index.contains(path)) {
+                m_result.push_back({DifferenceKind::ADDED, path, element->getTag()});
+            }
+        }
+        std::sort(m_result.begin(), m_result.end(), [](const ModelDifference& lhs, const ModelDifference& rhs) {
+            return lhs.path < rhs.path;
+        });
+        return m_result;
+    }
+
+    std::vector<ModelDifference> ModelComparator::compare(const project::ModelProject& lhs,
+                                                          const project::ModelProject& rhs) {
+        auto load = [](const project::ModelProject& project) {
+            utilities::DefaultParserFacade parser;
+            parser.enableContentHashing();
+            project::ModelProject::openModelFromProject(project, parser);
+            return parser.getModel();
+        };
+        auto rhs_loading = std::async(std::launch::async, load, std::cref(rhs));
+        auto lhs_model = load(lhs);
+        auto rhs_model = rhs_loading.get();
+        ModelComparator comparator(*lhs_model, *rhs_model);
+        return comparator.compare();
+    }
+
+    void ModelComparator::compareElements(const std::string& path, const model::IAutosarElement& lhs,
+                                          const model::IAutosarElement& rhs) {
+        if (lhs.getTag() != rhs.getTag() or lhs.isComposite() != rhs.isComposite()) {
+            m_result.push_back({DifferenceKind::CHANGED, path, lhs.getTag() + " replaced by " + rhs.getTag()});
+            return;
+        }
+        if (not lhs.isComposite()) {
+            compareValues(path, dynamic_cast<const model::ISimpleAutosarElement&>(lhs),
+                          dynamic_cast<const model::ISimpleAutosarElement&>(rhs));
+            return;
+        }
+        // Only named elements store their hash, hashing an unnamed composite would walk it again at every level
+        auto* lhs_named = dynamic_cast<const model::INamedAutosarElement*>(&lhs);
+        auto* rhs_named = dynamic_cast<const model::INamedAutosarElement*>(&rhs);
+        if (m_hashed and lhs_named and rhs_named and lhs_named->getContentHash() == rhs_named->getContentHash()) {
+            return;
+        }
+        compareSubElements(path, dynamic_cast<const model::ICompositeAutosarElement&>(lhs),
+                           dynamic_cast<const model::ICompositeAutosarElement&>(rhs));
+    }
+
+    void ModelComparator::compareSubElements(const std::string& path, const model::ICompositeAutosarElement& lhs,
+                                             const model::ICompositeAutosarElement& rhs) {
+        std::unordered_map<std::string, int> occurrences;
+        std::unordered_map<std::string, const model::IAutosarElement*> rhs_children;
+        for (const auto& child: rhs.getSubElements()) {
+            rhs_children.emplace(childPath(path, child, occurrences), &child);
+        }
+        occurrences.clear();
+        for (const auto& child: lhs.getSubElements()) {
+            auto child_path = childPath(path, child, occurrences);
+            auto found = rhs_children.find(child_path);
+            if (found == rhs_children.end()) {
+                m_result.push_back({DifferenceKind::REMOVED, child_path, child.getTag()});
+                continue;
+            }
+            compareElements(child_path, child, *found->second);
+            rhs_children.erase(found);
+        }
+        for (auto& [child_path, child]: rhs_children) {
+            m_result.push_back({DifferenceKind::ADDED, child_path, child->getTag()});
+        }
+    }
+
+    void ModelComparator::compareValues(const std::string& path, const model::ISimpleAutosarElement& lhs,
+                                        const model::ISimpleAutosarElement& rhs) {
+        auto lhs_value = simple_value(lhs);
+        auto rhs_value = simple_value(rhs);
+        if (lhs_value != rhs_value) {
+            m_result.push_back({DifferenceKind::CHANGED, path, "'" + lhs_value + "' -> '" + rhs_value + "'"});
+        }
+        for (const auto& [name, value]: lhs.getAttributes()) {
+            auto attribute_path = path + "@" + std::string(name);
+            auto other = rhs.getAttribute(name);
+            if (not other.has_value()) {
+                m_result.push_back({DifferenceKind::REMOVED, attribute_path, std::string(value)});
+            }
+            else if (other.value() != value) {
+                m_result.push_back({DifferenceKind::CHANGED, attribute_path,
+                                    "'" + std::string(value) + "' -> '" + std::string(*other) + "'"});
+            }
+        }
+        for (const auto& [name, value]: rhs.getAttributes()) {
+            if (not lhs.getAttribute(name).has_value()) {
+                m_result.push_back({DifferenceKind::ADDED, path + "@" + std::string(name), std::string(value)});
+            }
+        }
+    }
+
+}
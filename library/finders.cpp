@@ -3,171 +3,134 @@
 //
 
 #include <arxml/helpers/finders.hpp>
-#include <sstream>
 
 namespace arxml::helpers {
 
     namespace {
-        std::string toString(const std::vector<std::string>& vec) {
-            std::stringstream ss;
-            std::for_each(vec.begin(), vec.end(), [&](const std::string& str) {
-                ss << '/' << str;
-            });
-            return ss.str();
-        }
-
-        bool is_root_element(const std::vector<std::string>& current_element,
-                             const std::vector<std::string>& full_path) {
-            if (current_element.size() > full_path.size()) {
-                return false;
-            }
-            int equal_counter = 0;
-            while (current_element[equal_counter] == full_path[equal_counter]) {
-                ++equal_counter;
-            }
-            return (equal_counter == current_element.size());
-        }
-
-        std::vector<std::string> splitPath(std::string path) {
-            // TODO: Simplify
-            std::vector<std::string> result;
-            for(auto& it: path) {
-                if (it == '/') {
-                    it = ' ';
-                }
-            }
-            std::stringstream ss(path);
-            std::string temp;
-            while(ss) {
-                ss >> temp;
-                result.emplace_back(std::move(temp));
-            }
-            if (result[result.size() - 1] == "") {
-                result.pop_back();
-            }
-
-            return result;
+        // The path without its last segment is known to lead towards the expected one
+        bool leads_to(const utilities::SymbolPath& path, const utilities::SymbolPath& expected_path) {
+            return path.sharesPrefix(expected_path, path.size());
         }
     }
 
-    void ElementByTagFinder::visit(model::IAutosarPackage& package) {
-        m_path.push_back(package.getName());
+    dfs::VisitResult ElementByTagFinder::visit(const model::IAutosarPackage& package) {
+        m_path.push(package.getNameId());
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ElementByTagFinder::visit(model::IAutosarElements& elements) {
+    dfs::VisitResult ElementByTagFinder::visit(const model::IAutosarElements& elements) {
         for (auto& it: elements.getElements()) {
-            if (it->getTag() == m_expected_tag) {
-                std::stringstream ss;
-                for (auto& part: m_path) {
-                    ss << "/" << part;
-                }
-                ss << "/" << it->getName();
-                m_result.emplace(ss.str(), std::ref(*it));
+            if (it.getTagId() == m_expected_tag) {
+                m_result.emplace(m_path.str(it.getNameId()), std::cref(it));
             }
         }
+        return dfs::VisitResult::SKIP_CHILDREN;
     }
 
-    void ElementByTagFinder::close(model::IAutosarPackage& package) {
-        m_path.pop_back();
+    void ElementByTagFinder::close(const model::IAutosarPackage& package) {
+        m_path.pop();
     }
 
-    void ElementByIdFinder::visit(model::IAutosarElement& element) {
-        if (element.getType() == arxml::model::EntryType::NAMED_ELEMENT) {
-            m_path.push_back(dynamic_cast<model::INamedAutosarElement&>(element).getName());
-            std::stringstream ss;
-            std::for_each(m_path.begin(), m_path.end(), [&](const std::string& value) {
-                ss << "/" << value;
-            });
-
-            if (m_expected_id == ss.str()) {
-                m_result.push_back(dynamic_cast<model::INamedAutosarElement&>(element));
-            }
+    ElementByIdFinder::ElementByIdFinder(std::vector<std::reference_wrapper<const model::INamedAutosarElement>>& result,
+                                         std::string expected_id)
+    : m_result{result}
+    , m_expected_path{utilities::SymbolPath::parse(expected_id)}
+    {
+
+    }
+
+    dfs::VisitResult ElementByIdFinder::visit(const model::IAutosarElement& element) {
+        if (element.getType() != arxml::model::EntryType::NAMED_ELEMENT) {
+            return element.isComposite() ? dfs::VisitResult::CONTINUE : dfs::VisitResult::SKIP_CHILDREN;
+        }
+        auto& named = dynamic_cast<const model::INamedAutosarElement&>(element);
+        m_path.push(named.getNameId());
+        if (not leads_to(m_path, m_expected_path)) {
+            return dfs::VisitResult::SKIP_CHILDREN;
+        }
+        if (m_path.size() == m_expected_path.size()) {
+            m_result.push_back(named);
+            return dfs::VisitResult::STOP;
         }
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ElementByIdFinder::visit(model::IAutosarPackage& package) {
-        m_path.push_back(package.getName());
+    dfs::VisitResult ElementByIdFinder::visit(const model::IAutosarPackage& package) {
+        m_path.push(package.getNameId());
+        return leads_to(m_path, m_expected_path) ? dfs::VisitResult::CONTINUE : dfs::VisitResult::SKIP_CHILDREN;
     }
 
-    void ElementByIdFinder::close(model::IAutosarPackage &package) {
-        m_path.pop_back();
+    void ElementByIdFinder::close(const model::IAutosarPackage& package) {
+        m_path.pop();
     }
 
-    void ElementByIdFinder::close(model::IAutosarElement& element) {
+    void ElementByIdFinder::close(const model::IAutosarElement& element) {
         if (element.getType() == arxml::model::EntryType::NAMED_ELEMENT) {
-            m_path.pop_back();
+            m_path.pop();
         }
     }
 
-    void ElementByReferenceFinder::visit(model::IAutosarElement& element) {
+    dfs::VisitResult ElementByReferenceFinder::visit(const model::IAutosarElement& element) {
         using namespace arxml::model;
 
         switch (element.getType()) {
             case model::EntryType::NAMED_ELEMENT: {
-                m_path.push_back(dynamic_cast<INamedAutosarElement &>(element).getName());
+                m_path.push(dynamic_cast<const INamedAutosarElement&>(element).getNameId());
                 break;
             }
-            case model::EntryType::STRING_ELEMENT: {
-                auto& string_element = dynamic_cast<IStringAutosarElement&>(element);
-                if (string_element.getAttribute("DEST").has_value()
-                    and string_element.getText() == m_expected_id) {
-                    std::stringstream ss;
-                    std::for_each(m_path.begin(),
-                                  m_path.end(),
-                                  [&](const std::string& p) {
-                                      ss << "/" << p;
-                                  });
-                    m_result.push_back(ss.str());
+            case model::EntryType::REFERENCE_ELEMENT: {
+                if (dynamic_cast<const IReferenceAutosarElement&>(element).getTargetSegments() == m_expected_path.segments()) {
+                    m_result.push_back(m_path.str());
                 }
             }
             default: break;
         }
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ElementByReferenceFinder::visit(model::IAutosarPackage& package) {
-        m_path.push_back(package.getName());
+    dfs::VisitResult ElementByReferenceFinder::visit(const model::IAutosarPackage& package) {
+        m_path.push(package.getNameId());
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ElementByReferenceFinder::close(model::IAutosarPackage &package) {
-        m_path.pop_back();
+    void ElementByReferenceFinder::close(const model::IAutosarPackage& package) {
+        m_path.pop();
     }
 
-    void ElementByReferenceFinder::close(model::IAutosarElement& element) {
+    void ElementByReferenceFinder::close(const model::IAutosarElement& element) {
         if (element.getType() == arxml::model::EntryType::NAMED_ELEMENT) {
-            m_path.pop_back();
+            m_path.pop();
         }
     }
 
-    RootElementFinder::RootElementFinder(std::optional<std::pair<std::string, model::INamedAutosarElement&>>& result,
+    RootElementFinder::RootElementFinder(std::optional<std::pair<std::string, const model::INamedAutosarElement&>>& result,
                                          const std::string& full_path)
     : m_result{result}
-    , m_full_path{splitPath(full_path)}
+    , m_full_path{utilities::SymbolPath::parse(full_path)}
     {
 
     }
 
 
-    void RootElementFinder::visit(model::IAutosarPackage& package) {
-        m_path.push_back(package.getName());
+    dfs::VisitResult RootElementFinder::visit(const model::IAutosarPackage& package) {
+        m_path.push(package.getNameId());
+        return leads_to(m_path, m_full_path) ? dfs::VisitResult::CONTINUE : dfs::VisitResult::SKIP_CHILDREN;
     }
 
-    void RootElementFinder::visit(model::IAutosarElements& elements) {
+    dfs::VisitResult RootElementFinder::visit(const model::IAutosarElements& elements) {
         for (auto& it: elements.getElements()) {
-            m_path.push_back(it->getName());
-            if (is_root_element(m_path, m_full_path)) {
-                std::stringstream ss;
-                std::for_each(m_path.begin(), m_path.end(), [&](const std::string& str) {
-                    ss << '/' << str;
-                });
-
-                m_result = std::make_pair(ss.str(), std::ref(*it));
+            m_path.push(it.getNameId());
+            if (leads_to(m_path, m_full_path)) {
+                m_result.emplace(m_path.str(), it);
+                return dfs::VisitResult::STOP;
             }
-            m_path.pop_back();
+            m_path.pop();
         }
+        return dfs::VisitResult::SKIP_CHILDREN;
     }
 
-    void RootElementFinder::close(model::IAutosarPackage& package) {
-        m_path.pop_back();
+    void RootElementFinder::close(const model::IAutosarPackage& package) {
+        m_path.pop();
     }
 
-}
\ No newline at end of file
+}
@@ -4,11 +4,68 @@
 
 #include "arxml/utilities/input_source.hpp"
 
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#if __has_include(<fcntl.h>) and __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef ARXML_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef ARXML_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+#include "arxml/utilities/instrumentation.hpp"
 
 namespace arxml::utilities::io {
+
+    namespace {
+        constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+        constexpr std::string_view MODEL_EXTENSION = ".arxml";
+        constexpr std::string_view GZIP_EXTENSION = ".gz";
+        constexpr std::string_view ZSTD_EXTENSION = ".zst";
+
+        std::size_t remainingSize(std::ifstream& input) {
+            auto position = input.tellg();
+            input.seekg(0, std::ios::end);
+            auto end = input.tellg();
+            input.seekg(position);
+            return position < 0 or end < position ? 0 : static_cast<std::size_t>(end - position);
+        }
+
+        // Feeds the file chunk by chunk to the decoder, which appends decompressed data to the content
+        template<typename Decoder>
+        void decompress(std::ifstream& input, std::string& content, Decoder&& decoder) {
+            std::array<char, CHUNK_SIZE> chunk{};
+            while (input) {
+                input.read(chunk.data(), chunk.size());
+                auto size = static_cast<std::size_t>(input.gcount());
+                if (size == 0) {
+                    break;
+                }
+                ARXML_PROFILE_COUNT(instrumentation::Counter::BYTES, size);
+                decoder(std::string_view(chunk.data(), size), content);
+            }
+        }
+
+        // Grows the content by a chunk and returns the free part for the decoder to fill
+        std::pair<char*, std::size_t> reserveOutput(std::string& content, std::size_t& used) {
+            if (content.size() - used < CHUNK_SIZE) {
+                content.resize(std::max(content.size() * 2, used + CHUNK_SIZE));
+            }
+            return {content.data() + used, content.size() - used};
+        }
+    }
+
     bool FileSource::open(std::string_view filename) {
-        m_input.open(std::string(filename));
+        m_input.open(std::string(filename), std::ios::binary);
         if (m_input.is_open()) {
             m_opened = true;
             return true;
@@ -20,13 +77,197 @@ namespace arxml::utilities::io {
         if (not m_opened) {
             return "";
         }
-        std::stringstream ss;
-        std::string line;
-        while (m_input) {
-            std::getline(m_input, line);
-            ss << line;
+        ARXML_PROFILE_SCOPE(instrumentation::Phase::READ);
+        std::string content(remainingSize(m_input), '\0');
+        m_input.read(content.data(), static_cast<std::streamsize>(content.size()));
+        content.resize(static_cast<std::size_t>(m_input.gcount()));
+        // Size may be unknown, e.g. for pipes, or the file may have grown in the meantime
+        std::array<char, CHUNK_SIZE> chunk{};
+        while (m_input.read(chunk.data(), chunk.size()) or m_input.gcount() > 0) {
+            content.append(chunk.data(), static_cast<std::size_t>(m_input.gcount()));
+        }
+        ARXML_PROFILE_COUNT(instrumentation::Counter::BYTES, content.size());
+        return content;
+    }
+
+    bool GzipFileSource::open(std::string_view filename) {
+        m_input.open(std::string(filename), std::ios::binary);
+        m_opened = m_input.is_open();
+        return m_opened;
+    }
+
+    std::string GzipFileSource::getContent() {
+        if (not m_opened) {
+            return "";
+        }
+#ifdef ARXML_HAS_ZLIB
+        ARXML_PROFILE_SCOPE(instrumentation::Phase::READ);
+        // Compressed size is a cheap first guess of the output size, XML usually compresses several times
+        std::string content;
+        content.resize(std::max(CHUNK_SIZE, remainingSize(m_input) * 4));
+        std::size_t used = 0;
+
+        z_stream stream{};
+        // 32 enables automatic detection of gzip and zlib headers
+        if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+            throw std::runtime_error("Cannot initialise gzip decompression");
+        }
+        std::unique_ptr<z_stream, decltype(&inflateEnd)> guard(&stream, &inflateEnd);
+        bool finished = false;
+        decompress(m_input, content, [&](std::string_view chunk, std::string& output) {
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+            stream.avail_in = static_cast<uInt>(chunk.size());
+            while (stream.avail_in > 0) {
+                if (finished) {
+                    // Concatenated gzip members form a single stream
+                    inflateReset(&stream);
+                    finished = false;
+                }
+                auto [free, available] = reserveOutput(output, used);
+                stream.next_out = reinterpret_cast<Bytef*>(free);
+                stream.avail_out = static_cast<uInt>(std::min<std::size_t>(available, std::numeric_limits<uInt>::max()));
+                auto result = inflate(&stream, Z_NO_FLUSH);
+                used += static_cast<std::size_t>(reinterpret_cast<char*>(stream.next_out) - free);
+                if (result == Z_STREAM_END) {
+                    finished = true;
+                }
+                else if (result != Z_OK and result != Z_BUF_ERROR) {
+                    throw std::runtime_error(std::string("Corrupted gzip stream: ") + (stream.msg ? stream.msg : "unknown error"));
+                }
+            }
+        });
+        if (not finished) {
+            throw std::runtime_error("Truncated gzip stream");
+        }
+        content.resize(used);
+        return content;
+#else
+        throw std::runtime_error("Reading gzip compressed models requires the library to be built with zlib");
+#endif
+    }
+
+    bool ZstdFileSource::open(std::string_view filename) {
+        m_input.open(std::string(filename), std::ios::binary);
+        m_opened = m_input.is_open();
+        return m_opened;
+    }
+
+    std::string ZstdFileSource::getContent() {
+        if (not m_opened) {
+            return "";
+        }
+#ifdef ARXML_HAS_ZSTD
+        ARXML_PROFILE_SCOPE(instrumentation::Phase::READ);
+        std::string content;
+        content.resize(std::max(CHUNK_SIZE, remainingSize(m_input) * 4));
+        std::size_t used = 0;
+
+        std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+        if (not context) {
+            throw std::runtime_error("Cannot initialise zstd decompression");
+        }
+        bool first = true;
+        std::size_t pending = 0;
+        decompress(m_input, content, [&](std::string_view chunk, std::string& output) {
+            if (first) {
+                // Frames written by the zstd tool usually carry the decompressed size
+                auto size = ZSTD_getFrameContentSize(chunk.data(), chunk.size());
+                if (size != ZSTD_CONTENTSIZE_UNKNOWN and size != ZSTD_CONTENTSIZE_ERROR and size > output.size()) {
+                    output.resize(static_cast<std::size_t>(size));
+                }
+                first = false;
+            }
+            ZSTD_inBuffer input{chunk.data(), chunk.size(), 0};
+            while (input.pos < input.size) {
+                auto [free, available] = reserveOutput(output, used);
+                ZSTD_outBuffer buffer{free, available, 0};
+                pending = ZSTD_decompressStream(context.get(), &buffer, &input);
+                if (ZSTD_isError(pending)) {
+                    throw std::runtime_error(std::string("Corrupted zstd stream: ") + ZSTD_getErrorName(pending));
+                }
+                used += buffer.pos;
+            }
+        });
+        // Decoder may still hold decompressed data which did not fit into the output
+        while (pending != 0) {
+            auto [free, available] = reserveOutput(content, used);
+            ZSTD_inBuffer input{nullptr, 0, 0};
+            ZSTD_outBuffer buffer{free, available, 0};
+            pending = ZSTD_decompressStream(context.get(), &buffer, &input);
+            if (ZSTD_isError(pending) or buffer.pos == 0) {
+                throw std::runtime_error("Truncated zstd stream");
+            }
+            used += buffer.pos;
+        }
+        content.resize(used);
+        return content;
+#else
+        throw std::runtime_error("Reading zstd compressed models requires the library to be built with zstd");
+#endif
+    }
+
+    std::optional<Compression> model_file_compression(std::string_view filename) noexcept {
+        if (filename.ends_with(MODEL_EXTENSION)) {
+            return Compression::NONE;
+        }
+        for (auto [extension, compression]: {std::pair{GZIP_EXTENSION, Compression::GZIP},
+                                             std::pair{ZSTD_EXTENSION, Compression::ZSTD}}) {
+            if (filename.ends_with(extension)
+                and filename.substr(0, filename.size() - extension.size()).ends_with(MODEL_EXTENSION)) {
+                return compression;
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool is_compression_available(Compression compression) noexcept {
+        switch (compression) {
+            case Compression::GZIP:
+#ifdef ARXML_HAS_ZLIB
+                return true;
+#else
+                return false;
+#endif
+            case Compression::ZSTD:
+#ifdef ARXML_HAS_ZSTD
+                return true;
+#else
+                return false;
+#endif
+            default:
+                return true;
+        }
+    }
+
+    std::string uncompressed_name(const std::string& filename) {
+        for (auto extension: {GZIP_EXTENSION, ZSTD_EXTENSION}) {
+            if (filename.ends_with(extension)) {
+                return filename.substr(0, filename.size() - extension.size());
+            }
+        }
+        return filename;
+    }
+
+    std::unique_ptr<IInputSource> open_file_source(const std::string& filename) {
+        switch (model_file_compression(filename).value_or(Compression::NONE)) {
+            case Compression::GZIP:
+                return std::make_unique<GzipFileSource>(filename);
+            case Compression::ZSTD:
+                return std::make_unique<ZstdFileSource>(filename);
+            default:
+                return std::make_unique<FileSource>(filename);
+        }
+    }
+
+    void prefetch_file(const std::string& filename) noexcept {
+#ifdef POSIX_FADV_WILLNEED
+        auto descriptor = ::open(filename.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            return;
         }
-        return ss.str();
+        ::posix_fadvise(descriptor, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(descriptor);
+#endif
     }
 
     bool StringSource::open(std::string_view input) {
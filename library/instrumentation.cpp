@@ -0,0 +1,148 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/instrumentation.hpp>
+
+#include <iomanip>
+#include <numeric>
+
+namespace arxml::utilities::instrumentation {
+
+    namespace {
+        thread_local UnitProfile* t_current_unit = nullptr;
+        thread_local ScopedTimer* t_active_timer = nullptr;
+
+        constexpr std::array<const char*, PHASE_COUNT> PHASE_NAMES = {
+                "read", "xml", "build", "classify", "alloc", "register", "hash", "traverse"
+        };
+
+        std::uint64_t load(const std::atomic<std::uint64_t>& value) {
+            return value.load(std::memory_order_relaxed);
+        }
+
+        struct Summary {
+            std::array<std::uint64_t, PHASE_COUNT> nanoseconds{};
+            std::array<std::uint64_t, COUNTER_COUNT> counters{};
+
+            void add(const UnitProfile& unit) {
+                for (std::size_t it = 0; it < PHASE_COUNT; ++it) {
+                    nanoseconds[it] += load(unit.nanoseconds[it]);
+                }
+                for (std::size_t it = 0; it < COUNTER_COUNT; ++it) {
+                    counters[it] += load(unit.counters[it]);
+                }
+            }
+
+            [[nodiscard]] std::uint64_t counter(Counter counter) const {
+                return counters[static_cast<std::size_t>(counter)];
+            }
+        };
+
+        void printRow(std::ostream& os, const Summary& summary, const std::string& name) {
+            auto total = std::accumulate(summary.nanoseconds.begin(), summary.nanoseconds.end(), std::uint64_t{0});
+            for (auto nanoseconds: summary.nanoseconds) {
+                os << std::setw(10) << static_cast<double>(nanoseconds) / 1e6;
+            }
+            os << std::setw(10) << static_cast<double>(total) / 1e6;
+            auto bytes = summary.counter(Counter::BYTES);
+            os << std::setw(10) << (total > 0 ? static_cast<double>(bytes) * 1e3 / static_cast<double>(total) : 0.0);
+            auto nodes = summary.counter(Counter::PACKAGES) + summary.counter(Counter::NAMED_ELEMENTS)
+                       + summary.counter(Counter::COMPOSITE_ELEMENTS) + summary.counter(Counter::SIMPLE_ELEMENTS);
+            os << std::setw(10) << nodes << std::setw(10) << summary.counter(Counter::ALLOCATIONS)
+               << "  " << name << "\n";
+        }
+    }
+
+    Profiler& Profiler::instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    UnitProfile& Profiler::registerUnit(std::string name) {
+        std::lock_guard lock(m_mutex);
+        return m_units.emplace_back(std::move(name));
+    }
+
+    void Profiler::report(std::ostream& os) const {
+        std::lock_guard lock(m_mutex);
+        auto flags = os.flags();
+        os << std::fixed << std::setprecision(2);
+        os << "Wall time per phase [ms], throughput [MB/s], node and allocation counts:\n";
+        for (auto name: PHASE_NAMES) {
+            os << std::setw(10) << name;
+        }
+        os << std::setw(10) << "total" << std::setw(10) << "MB/s" << std::setw(10) << "nodes"
+           << std::setw(10) << "allocs" << "  unit\n";
+        Summary total;
+        for (const auto& unit: m_units) {
+            Summary summary;
+            summary.add(unit);
+            total.add(unit);
+            printRow(os, summary, unit.name);
+        }
+        if (m_units.size() > 1) {
+            printRow(os, total, "(all files)");
+        }
+        Summary global;
+        global.add(m_global);
+        printRow(os, global, m_global.name);
+        os.flags(flags);
+    }
+
+    UnitProfile& current_unit() noexcept {
+        return t_current_unit ? *t_current_unit : Profiler::instance().globalUnit();
+    }
+
+    UnitScope::UnitScope(std::string_view name)
+    : m_previous{t_current_unit}
+    , m_active{Profiler::instance().isEnabled()}
+    {
+        if (m_active) {
+            t_current_unit = &Profiler::instance().registerUnit(std::string(name));
+        }
+    }
+
+    UnitScope::~UnitScope() {
+        if (m_active) {
+            t_current_unit = m_previous;
+        }
+    }
+
+    ScopedTimer::ScopedTimer(Phase phase)
+    : m_unit{nullptr}
+    , m_phase{phase}
+    , m_start{}
+    , m_parent{nullptr}
+    {
+        if (not Profiler::instance().isEnabled()) {
+            return;
+        }
+        m_unit = &current_unit();
+        m_start = Clock::now();
+        m_parent = t_active_timer;
+        if (m_parent) {
+            m_parent->pause(m_start);
+        }
+        t_active_timer = this;
+    }
+
+    ScopedTimer::~ScopedTimer() {
+        if (not m_unit) {
+            return;
+        }
+        auto now = Clock::now();
+        pause(now);
+        t_active_timer = m_parent;
+        if (m_parent) {
+            m_parent->m_start = now;
+        }
+    }
+
+    void ScopedTimer::pause(Clock::time_point now) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start).count();
+        m_unit->nanoseconds[static_cast<std::size_t>(m_phase)].fetch_add(static_cast<std::uint64_t>(elapsed),
+                                                                          std::memory_order_relaxed);
+    }
+
+}
@@ -5,54 +5,76 @@
 #include "arxml/utilities/model_component_factory.hpp"
 
 #include "model_elements_impl.hpp"
+#include "arxml/utilities/instrumentation.hpp"
+
+#define ARXML_PROFILE_ALLOCATION() \
+    ARXML_PROFILE_SCOPE(instrumentation::Phase::ALLOCATION); \
+    ARXML_PROFILE_COUNT(instrumentation::Counter::ALLOCATIONS, 1)
 
 namespace arxml::utilities::parser {
     std::unique_ptr<model::IAutosarModel> ModelComponentFactory::createRoot() const noexcept {
-        std::unique_ptr<model::IAutosarModel> result(new model::AutosarModel);
+        ARXML_PROFILE_ALLOCATION();
+        std::unique_ptr<model::IAutosarModel> result(new (m_memory) model::AutosarModel);
         return result;
     }
 
     std::unique_ptr<model::IModelEntry> ModelComponentFactory::createModelEntry(std::string unit_name, std::string xmlns, std::string xmlns_xsi, std::string xmlns_schema_location) const noexcept {
-        return std::unique_ptr<model::IModelEntry>(new model::AutosarModelEntry(std::move(unit_name), std::move(xmlns), std::move(xmlns_xsi), std::move(xmlns_schema_location)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::IModelEntry>(new (m_memory) model::AutosarModelEntry(std::move(unit_name), std::move(xmlns), std::move(xmlns_xsi), std::move(xmlns_schema_location)));
     }
 
     std::unique_ptr<model::IAutosarPackages> ModelComponentFactory::createPackages() const noexcept {
-        return std::unique_ptr<model::IAutosarPackages>(new model::AutosarPackages());
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::IAutosarPackages>(new (m_memory) model::AutosarPackages());
     }
 
     std::unique_ptr<model::IAutosarPackage>
     ModelComponentFactory::createPackage(std::string name, std::unique_ptr<model::IAutosarElements> elements) const noexcept {
-        return std::unique_ptr<model::IAutosarPackage>(new model::AutosarPackage(std::move(name), std::move(elements)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::IAutosarPackage>(new (m_memory) model::AutosarPackage(std::move(name), std::move(elements)));
     }
 
     std::unique_ptr<model::IAutosarPackage>
     ModelComponentFactory::createPackage(std::string name, std::unique_ptr<model::IAutosarPackages> packages) const noexcept {
-        return std::unique_ptr<model::IAutosarPackage>(new model::AutosarPackage(std::move(name), std::move(packages)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::IAutosarPackage>(new (m_memory) model::AutosarPackage(std::move(name), std::move(packages)));
     }
 
     std::unique_ptr<model::IAutosarElements> ModelComponentFactory::createElements() const noexcept {
-        return std::unique_ptr<model::IAutosarElements>(new model::AutosarElements());
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::IAutosarElements>(new (m_memory) model::AutosarElements());
     }
 
     std::unique_ptr<model::ICompositeAutosarElement> ModelComponentFactory::createCompositeElement(std::string tag) const noexcept {
-        return std::unique_ptr<model::ICompositeAutosarElement>(new model::CompositeAutosarElement(std::move(tag)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::ICompositeAutosarElement>(new (m_memory) model::CompositeAutosarElement(std::move(tag)));
     }
 
     std::unique_ptr<model::INamedAutosarElement>
     ModelComponentFactory::createNamedCompositeElement(std::string tag, std::string name) const noexcept {
-        return std::unique_ptr<model::INamedAutosarElement>(new model::NamedAutosarElement(std::move(tag), std::move(name)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::INamedAutosarElement>(new (m_memory) model::NamedAutosarElement(std::move(tag), std::move(name)));
     }
 
     std::unique_ptr<model::ISimpleAutosarElement> ModelComponentFactory::createNumberElement(std::string tag, double value) const noexcept {
-        return std::unique_ptr<model::ISimpleAutosarElement>(new model::NumberAutosarElement(std::move(tag), value));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::ISimpleAutosarElement>(new (m_memory) model::NumberAutosarElement(std::move(tag), value));
     }
 
     std::unique_ptr<model::ISimpleAutosarElement> ModelComponentFactory::createNumberElement(std::string tag, int value) const noexcept {
-        return std::unique_ptr<model::ISimpleAutosarElement>(new model::NumberAutosarElement(std::move(tag), value));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::ISimpleAutosarElement>(new (m_memory) model::NumberAutosarElement(std::move(tag), value));
     }
 
     std::unique_ptr<model::ISimpleAutosarElement> ModelComponentFactory::createStringElement(std::string tag, std::string value) const noexcept {
-        return std::unique_ptr<model::ISimpleAutosarElement>(new model::StringAutosarElement(std::move(tag), std::move(value)));
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::ISimpleAutosarElement>(new (m_memory) model::StringAutosarElement(std::move(tag), std::move(value)));
+    }
+
+    std::unique_ptr<model::ISimpleAutosarElement>
+    ModelComponentFactory::createReferenceElement(std::string tag, std::string target, std::string_view destination) const noexcept {
+        ARXML_PROFILE_ALLOCATION();
+        return std::unique_ptr<model::ISimpleAutosarElement>(new (m_memory) model::ReferenceAutosarElement(std::move(tag), std::move(target), destination));
     }
 
 }
@@ -4,12 +4,114 @@
 
 #include "model_elements_impl.hpp"
 
+#include <new>
+
 namespace arxml::model {
 
-    std::optional<std::string> AbstractSimpleAutosarElement::getAttribute(std::string_view name) {
-        auto comparer = [&](const AttributePair& attribute) { return attribute.first == name; };
-        const auto found_item = std::find_if(m_attributes.begin(), m_attributes.end(), comparer);
-        return (found_item == m_attributes.end() ? std::optional<std::string>() : std::make_optional(found_item->second));
+    namespace {
+        using Pending = std::vector<std::unique_ptr<IAutosarModelObject>>;
+
+        // Work list of the last teardown on the thread, the next one reuses its capacity
+        thread_local Pending t_pending;
+
+        template<typename Child>
+        void detachChild(Child& child, Pending& pending) noexcept {
+            try {
+                pending.emplace_back(std::move(child));
+            } catch (const std::bad_alloc&) {
+                // Without memory for the work list the child goes the recursive way, emplace_back left it in place
+                child.reset();
+            }
+        }
+
+        template<typename Children>
+        void detach(Children& children, Pending& pending) noexcept {
+            for (auto& child: children) {
+                detachChild(child, pending);
+            }
+            children.clear();
+        }
+
+        void detachChildren(IAutosarModelObject& node, Pending& pending) noexcept {
+            switch (node.getType()) {
+                case EntryType::AUTOSAR: {
+                    auto& units = dynamic_cast<IAutosarModel&>(node).getModelUnits();
+                    for (auto& [name, entry]: units) {
+                        detachChild(entry, pending);
+                    }
+                    units.clear();
+                    break;
+                }
+                case EntryType::PACKAGES:
+                    detach(dynamic_cast<IAutosarPackages&>(node).getPackages(), pending);
+                    break;
+                case EntryType::PACKAGE: {
+                    // The collection stays with the package, only its children are taken
+                    auto& package = dynamic_cast<IAutosarPackage&>(node);
+                    if (package.getCollectionType() == CollectionType::ELEMENTS_COLLECTION) {
+                        detach(package.getElements().getElements(), pending);
+                    } else {
+                        detach(package.getPackages().getPackages(), pending);
+                    }
+                    break;
+                }
+                case EntryType::ELEMENTS:
+                    detach(dynamic_cast<IAutosarElements&>(node).getElements(), pending);
+                    break;
+                case EntryType::COMPOSITE_ELEMENT:
+                case EntryType::NAMED_ELEMENT:
+                    detach(dynamic_cast<ICompositeAutosarElement&>(node).getSubElements(), pending);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void* ModelNode::operator new(std::size_t size, utilities::ModelMemoryResource* memory) {
+        return memory ? memory->allocate(size) : ::operator new(size);
+    }
+
+    void ModelNode::operator delete(void* pointer) noexcept {
+        if (auto* memory = utilities::ModelMemoryResource::owner(pointer)) {
+            memory->deallocate(pointer);
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    void dismantle(IAutosarModelObject& node) noexcept {
+        Pending pending;
+        pending.swap(t_pending);
+        detachChildren(node, pending);
+        while (not pending.empty()) {
+            auto next = std::move(pending.back());
+            pending.pop_back();
+            detachChildren(*next, pending);
+            // next is deleted here without children, its own dismantle finds nothing to do
+        }
+        if (pending.capacity() > t_pending.capacity()) {
+            pending.swap(t_pending);
+        }
+    }
+
+    std::optional<std::string_view> AbstractSimpleAutosarElement::getAttribute(std::string_view name) const noexcept {
+        return m_attributes.find(name);
+    }
+
+    ReferenceAutosarElement::ReferenceAutosarElement(std::string tag, std::string target, std::string_view destination)
+    : m_element(std::move(tag))
+    , m_target{std::move(target)}
+    , m_destination{utilities::intern(destination)}
+    {
+        std::string_view path = m_target;
+        while (not path.empty()) {
+            auto end = path.find('/');
+            if (end != 0) {
+                m_segments.push_back(utilities::intern(path.substr(0, end)));
+            }
+            path = end == std::string_view::npos ? std::string_view{} : path.substr(end + 1);
+        }
     }
 
 }
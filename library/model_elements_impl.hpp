@@ -5,27 +5,47 @@
 #pragma once
 
 #include <arxml/elements.hpp>
+#include <arxml/utilities/model_memory.hpp>
 
 namespace arxml::model{
 
-    class AutosarModel : public IAutosarModel {
+    // Nodes live on the heap or in a memory resource given to new. Delete finds the resource by the address of
+    // the node, so the unique_ptr holding it deletes it correctly either way.
+    class ModelNode {
     public:
+        static void* operator new(std::size_t size) { return ::operator new(size); }
+        static void* operator new(std::size_t size, utilities::ModelMemoryResource* memory);
+        static void operator delete(void* pointer) noexcept;
+        static void operator delete(void* pointer, utilities::ModelMemoryResource* memory) noexcept { operator delete(pointer); }
+    };
+
+    // Destroys the subtree below the node with a work list. Deleting it through the nested unique_ptrs would
+    // recurse once per level of the tree.
+    void dismantle(IAutosarModelObject& node) noexcept;
+
+    class AutosarModel : public IAutosarModel, public ModelNode {
+    public:
+        ~AutosarModel() override { dismantle(*this); }
         void registerModelEntry(const std::string& entry_name, std::unique_ptr<IModelEntry> package) override { m_packages[entry_name] = std::move(package);}
         IModelEntry& getModelEntry(const std::string& entry_name) override { return *m_packages.at(entry_name); }
+        [[nodiscard]] const IModelEntry& getModelEntry(const std::string& entry_name) const override { return *m_packages.at(entry_name); }
         [[nodiscard]] ModelUnitMap& getModelUnits() noexcept override { return m_packages; }
+        [[nodiscard]] ConstPointerRange<IModelEntry, ModelUnitMap> getModelUnits() const noexcept override { return ConstPointerRange<IModelEntry, ModelUnitMap>(m_packages); }
     private:
         ModelUnitMap m_packages;
     };
 
-    class AutosarPackages : public IAutosarPackages {
+    class AutosarPackages : public IAutosarPackages, public ModelNode {
     public:
+        ~AutosarPackages() override { dismantle(*this); }
         PackagePtrContainer& getPackages() noexcept override { return m_container; }
+        [[nodiscard]] ConstPointerRange<IAutosarPackage> getPackages() const noexcept override { return ConstPointerRange<IAutosarPackage>(m_container); }
         void addPackage(PackagePtr package) noexcept override { m_container.emplace_back(std::move(package)); }
     private:
         PackagePtrContainer m_container;
     };
 
-    class AutosarModelEntry : virtual public IModelEntry {
+    class AutosarModelEntry : virtual public IModelEntry, public ModelNode {
     public:
         explicit AutosarModelEntry(std::string source, std::string xmlns, std::string xmlns_xsi,
                                    std::string xmlns_schema_location)
@@ -36,12 +56,13 @@ namespace arxml::model{
                 , m_packages{} {
         }
 
-        std::string getEntryName() override { return m_source; }
+        std::string getEntryName() const override { return m_source; }
         const std::string& getXmlns() const noexcept override { return m_xmlns; }
         const std::string& getXmlnsXsi() const noexcept override { return m_xmlns_xsi; }
         const std::string& getSchemaLocation() const noexcept override { return m_xmlns_schema_location; }
 
         PackagePtrContainer& getPackages() noexcept override { return m_packages.getPackages(); }
+        [[nodiscard]] ConstPointerRange<IAutosarPackage> getPackages() const noexcept override { return m_packages.getPackages(); }
         void addPackage(PackagePtr package) noexcept override { m_packages.addPackage(std::move(package)); }
 
     private:
@@ -52,30 +73,40 @@ namespace arxml::model{
         AutosarPackages m_packages;
     };
 
-    class AutosarPackage : public IAutosarPackage {
+    class AutosarPackage : public IAutosarPackage, public ModelNode {
     public:
         AutosarPackage(std::string name, std::unique_ptr<IAutosarElements> elements)
-                : m_name{std::move(name)}, m_elements{std::move(elements)}
-                , m_collection_type{CollectionType::ELEMENTS_COLLECTION} {}
+                : m_name{utilities::intern(name)}, m_elements{std::move(elements)}
+                , m_collection_type{CollectionType::ELEMENTS_COLLECTION}, m_content_hash{0} {}
 
         AutosarPackage(std::string name, std::unique_ptr<IAutosarPackages> packages)
-                : m_name{std::move(name)}, m_elements{std::move(packages)}
-                , m_collection_type{CollectionType::PACKAGES_COLLECTION} {}
+                : m_name{utilities::intern(name)}, m_elements{std::move(packages)}
+                , m_collection_type{CollectionType::PACKAGES_COLLECTION}, m_content_hash{0} {}
+
+        ~AutosarPackage() override { dismantle(*this); }
 
         [[nodiscard]] CollectionType getCollectionType() const noexcept override { return m_collection_type; }
-        [[nodiscard]] const std::string& getName() const noexcept override { return m_name; }
+        [[nodiscard]] const std::string& getName() const noexcept override { return *m_name.address(); }
+        [[nodiscard]] utilities::Symbol getNameId() const noexcept override { return m_name; }
         IAutosarElements& getElements() override { return *std::get<std::unique_ptr<IAutosarElements>>(m_elements); }
+        const IAutosarElements& getElements() const override { return *std::get<std::unique_ptr<IAutosarElements>>(m_elements); }
         IAutosarPackages& getPackages() override { return *std::get<std::unique_ptr<IAutosarPackages>>(m_elements); }
+        const IAutosarPackages& getPackages() const override { return *std::get<std::unique_ptr<IAutosarPackages>>(m_elements); }
+        [[nodiscard]] std::uint64_t getContentHash() const noexcept override { return m_content_hash; }
+        void setContentHash(std::uint64_t hash) noexcept override { m_content_hash = hash; }
 
     private:
-        std::string m_name;
+        utilities::Symbol m_name;
         std::variant<std::unique_ptr<IAutosarElements>, std::unique_ptr<IAutosarPackages>> m_elements;
         CollectionType m_collection_type;
+        std::uint64_t m_content_hash;
     };
 
-    class AutosarElements : public IAutosarElements {
+    class AutosarElements : public IAutosarElements, public ModelNode {
     public:
+        ~AutosarElements() override { dismantle(*this); }
         [[nodiscard]] std::vector<std::unique_ptr<INamedAutosarElement>>& getElements() noexcept override { return m_elements; }
+        [[nodiscard]] ConstPointerRange<INamedAutosarElement> getElements() const noexcept override { return ConstPointerRange<INamedAutosarElement>(m_elements); }
         void addElement(std::unique_ptr<INamedAutosarElement> element) noexcept override { m_elements.emplace_back(std::move(element)); }
     private:
         std::vector<std::unique_ptr<INamedAutosarElement>> m_elements;
@@ -83,17 +114,18 @@ namespace arxml::model{
 
     class AbstractSimpleAutosarElement : public ISimpleAutosarElement {
     public:
-        explicit AbstractSimpleAutosarElement(std::string tag) : m_tag{std::move(tag)} {}
-        [[nodiscard]] std::string getTag() const noexcept override { return m_tag; }
-        void addAttribute(std::string name, std::string value) noexcept override { m_attributes.emplace_back(std::move(name), std::move(value)); }
-        [[nodiscard]] const std::vector<AttributePair>& getAttributes() const noexcept override { return m_attributes; }
-        std::optional<std::string> getAttribute(std::string_view name) override;
+        explicit AbstractSimpleAutosarElement(std::string tag) : m_tag{utilities::intern(tag)} {}
+        [[nodiscard]] std::string getTag() const noexcept override { return std::string(m_tag.view()); }
+        [[nodiscard]] utilities::Symbol getTagId() const noexcept override { return m_tag; }
+        void addAttribute(std::string_view name, std::string_view value) override { m_attributes.add(name, value); }
+        [[nodiscard]] const AttributeList& getAttributes() const noexcept override { return m_attributes; }
+        std::optional<std::string_view> getAttribute(std::string_view name) const noexcept override;
     private:
-        std::string m_tag;
-        std::vector<AttributePair> m_attributes;
+        utilities::Symbol m_tag;
+        AttributeList m_attributes;
     };
 
-    class NumberAutosarElement : public INumberAutosarElement {
+    class NumberAutosarElement : public INumberAutosarElement, public ModelNode {
     public:
         explicit NumberAutosarElement(std::string tag, double value)
                 : m_element(std::move(tag))
@@ -106,17 +138,15 @@ namespace arxml::model{
                 , m_type{EntryType::INTEGER_ELEMENT} {}
 
         // TODO: Add error handling due to invalid number type
-        int getInteger() override { return m_integer_value; }
-        double getFloating() override { return m_floating_value; }
+        int getInteger() const override { return m_integer_value; }
+        double getFloating() const override { return m_floating_value; }
         EntryType getType() const noexcept override { return m_type; }
 
-        void addAttribute(std::string name, std::string value) noexcept override {
-            m_element.addAttribute(std::move(name),
-                                   std::move(value));
-        }
-        std::optional<std::string> getAttribute(std::string_view name) override { return m_element.getAttribute(name); }
-        const std::vector<AttributePair>& getAttributes() const noexcept override { return m_element.getAttributes(); }
+        void addAttribute(std::string_view name, std::string_view value) override { m_element.addAttribute(name, value); }
+        std::optional<std::string_view> getAttribute(std::string_view name) const noexcept override { return m_element.getAttribute(name); }
+        const AttributeList& getAttributes() const noexcept override { return m_element.getAttributes(); }
         std::string getTag() const noexcept override { return m_element.getTag(); }
+        utilities::Symbol getTagId() const noexcept override { return m_element.getTagId(); }
     private:
         AbstractSimpleAutosarElement m_element;
         union {
@@ -126,56 +156,87 @@ namespace arxml::model{
         EntryType m_type;
     };
 
-    class StringAutosarElement : public IStringAutosarElement {
+    class StringAutosarElement : public IStringAutosarElement, public ModelNode {
     public:
         explicit StringAutosarElement(std::string tag, std::string text)
                 : m_element(std::move(tag))
                 , m_text{std::move(text)} {}
 
         EntryType getType() const noexcept override { return EntryType::STRING_ELEMENT; }
-        const std::string& getText() override { return m_text; }
+        const std::string& getText() const override { return m_text; }
 
-        void addAttribute(std::string name, std::string value) noexcept override {
-            m_element.addAttribute(std::move(name),
-                                   std::move(value));
-        }
-        std::optional<std::string> getAttribute(std::string_view name) override { return m_element.getAttribute(name); }
-        const std::vector<AttributePair>& getAttributes() const noexcept override { return m_element.getAttributes(); }
+        void addAttribute(std::string_view name, std::string_view value) override { m_element.addAttribute(name, value); }
+        std::optional<std::string_view> getAttribute(std::string_view name) const noexcept override { return m_element.getAttribute(name); }
+        const AttributeList& getAttributes() const noexcept override { return m_element.getAttributes(); }
         std::string getTag() const noexcept override { return m_element.getTag(); }
+        utilities::Symbol getTagId() const noexcept override { return m_element.getTagId(); }
 
     private:
         AbstractSimpleAutosarElement m_element;
         std::string m_text;
     };
 
-    class CompositeAutosarElement : public ICompositeAutosarElement {
+    class ReferenceAutosarElement : public IReferenceAutosarElement, public ModelNode {
+    public:
+        ReferenceAutosarElement(std::string tag, std::string target, std::string_view destination);
+
+        EntryType getType() const noexcept override { return EntryType::REFERENCE_ELEMENT; }
+        const std::string& getText() const override { return m_target; }
+        utilities::Symbol getDestination() const noexcept override { return m_destination; }
+        const std::vector<utilities::Symbol>& getTargetSegments() const noexcept override { return m_segments; }
+
+        void addAttribute(std::string_view name, std::string_view value) override { m_element.addAttribute(name, value); }
+        std::optional<std::string_view> getAttribute(std::string_view name) const noexcept override { return m_element.getAttribute(name); }
+        const AttributeList& getAttributes() const noexcept override { return m_element.getAttributes(); }
+        std::string getTag() const noexcept override { return m_element.getTag(); }
+        utilities::Symbol getTagId() const noexcept override { return m_element.getTagId(); }
+
+    private:
+        AbstractSimpleAutosarElement m_element;
+        std::string m_target;
+        utilities::Symbol m_destination;
+        std::vector<utilities::Symbol> m_segments;
+    };
+
+    class CompositeAutosarElement : public ICompositeAutosarElement, public ModelNode {
     public:
         explicit CompositeAutosarElement(std::string tag)
-                : m_tag{std::move(tag)} {}
+                : m_tag{utilities::intern(tag)} {}
+
+        ~CompositeAutosarElement() override { dismantle(*this); }
 
-        std::string getTag() const noexcept override { return m_tag; }
+        std::string getTag() const noexcept override { return std::string(m_tag.view()); }
+        utilities::Symbol getTagId() const noexcept override { return m_tag; }
         void addSubElement(std::unique_ptr<IAutosarElement> element) noexcept override { m_subelements.emplace_back(std::move(element)); }
         std::vector<std::unique_ptr<IAutosarElement>>& getSubElements() noexcept override { return m_subelements; }
+        ConstPointerRange<IAutosarElement> getSubElements() const noexcept override { return ConstPointerRange<IAutosarElement>(m_subelements); }
     private:
-        std::string m_tag;
+        utilities::Symbol m_tag;
         std::vector<std::unique_ptr<IAutosarElement>> m_subelements;
     };
 
-    class NamedAutosarElement : public virtual INamedAutosarElement {
+    class NamedAutosarElement : public virtual INamedAutosarElement, public ModelNode {
     public:
         NamedAutosarElement(std::string tag, std::string name)
                 : m_composite{std::move(tag)}
-                , m_name{std::move(name)} {}
+                , m_name{utilities::intern(name)}
+                , m_content_hash{0} {}
 
         EntryType getType() const noexcept override { return EntryType::NAMED_ELEMENT; }
-        std::string getName() const noexcept override { return m_name; }
+        std::string getName() const noexcept override { return std::string(m_name.view()); }
+        utilities::Symbol getNameId() const noexcept override { return m_name; }
 
         void addSubElement(std::unique_ptr<IAutosarElement> element) noexcept override { m_composite.addSubElement(std::move(element)); }
         std::vector<std::unique_ptr<IAutosarElement>>& getSubElements() noexcept override { return m_composite.getSubElements(); }
+        ConstPointerRange<IAutosarElement> getSubElements() const noexcept override { return m_composite.getSubElements(); }
         std::string getTag() const noexcept override { return m_composite.getTag(); }
+        utilities::Symbol getTagId() const noexcept override { return m_composite.getTagId(); }
+        std::uint64_t getContentHash() const noexcept override { return m_content_hash; }
+        void setContentHash(std::uint64_t hash) noexcept override { m_content_hash = hash; }
     private:
         CompositeAutosarElement m_composite;
-        std::string m_name;
+        utilities::Symbol m_name;
+        std::uint64_t m_content_hash;
     };
 
 }
@@ -0,0 +1,214 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/model_memory.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace arxml::utilities {
+
+    namespace {
+        // Generations are unique across all resources, a cursor left by a destroyed or released one never matches
+        std::atomic<std::uint64_t> g_next_generation{1};
+
+        struct Cursor {
+            std::uint64_t generation = 0;
+            std::byte* next = nullptr;
+            std::byte* end = nullptr;
+        };
+
+        // A few cursors per thread, so a thread switching between resources keeps bumping through its chunks
+        constexpr std::size_t THREAD_CURSORS = 4;
+        thread_local std::array<Cursor, THREAD_CURSORS> t_cursors;
+
+        Cursor& threadCursor(std::uint64_t generation) {
+            auto it = std::find_if(t_cursors.begin(), t_cursors.end(),
+                                   [generation](const Cursor& cursor) { return cursor.generation == generation; });
+            if (it != t_cursors.end()) {
+                return *it;
+            }
+            // The least recently added cursor gives way, the rest of its chunk stays unused until release
+            std::rotate(t_cursors.begin(), std::prev(t_cursors.end()), t_cursors.end());
+            t_cursors.front() = {};
+            return t_cursors.front();
+        }
+
+        // Owners of chunk sized slots of memory keyed by slot address. Chunks are aligned to their size, so a node
+        // finds its slot by masking its own address. Readers take no lock: a key is published after its owner and
+        // removed keys leave a marker behind, so probing never stops early.
+        class ChunkRegistry {
+        public:
+            static constexpr std::size_t SLOTS = 1 << 16;
+
+            void add(const std::byte* slot, ModelMemoryResource* owner) {
+                std::lock_guard lock(m_mutex);
+                auto key = reinterpret_cast<std::uintptr_t>(slot);
+                for (auto index = position(key);; index = (index + 1) % SLOTS) {
+                    auto stored = m_slots[index].key.load(std::memory_order_relaxed);
+                    if (stored == EMPTY and m_occupied == SLOTS - SLOTS / 4) {
+                        throw std::length_error("too many model memory chunks");
+                    }
+                    if (stored == EMPTY or stored == REMOVED) {
+                        m_occupied += stored == EMPTY;
+                        m_slots[index].owner.store(owner, std::memory_order_relaxed);
+                        m_slots[index].key.store(key, std::memory_order_release);
+                        m_live.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            }
+
+            void remove(const std::byte* slot) noexcept {
+                std::lock_guard lock(m_mutex);
+                auto key = reinterpret_cast<std::uintptr_t>(slot);
+                for (auto index = position(key);; index = (index + 1) % SLOTS) {
+                    auto stored = m_slots[index].key.load(std::memory_order_relaxed);
+                    if (stored == key) {
+                        m_slots[index].key.store(REMOVED, std::memory_order_release);
+                        m_live.fetch_sub(1, std::memory_order_relaxed);
+                        return;
+                    }
+                    if (stored == EMPTY) {
+                        return;
+                    }
+                }
+            }
+
+            ModelMemoryResource* find(const void* pointer) const noexcept {
+                // Models on the heap skip the lookup as long as no resource holds memory
+                if (m_live.load(std::memory_order_relaxed) == 0) {
+                    return nullptr;
+                }
+                auto key = reinterpret_cast<std::uintptr_t>(pointer) & ~(ModelMemoryResource::CHUNK_SIZE - 1);
+                for (auto index = position(key);; index = (index + 1) % SLOTS) {
+                    auto stored = m_slots[index].key.load(std::memory_order_acquire);
+                    if (stored == key) {
+                        return m_slots[index].owner.load(std::memory_order_relaxed);
+                    }
+                    if (stored == EMPTY) {
+                        return nullptr;
+                    }
+                }
+            }
+        private:
+            // Slot addresses are aligned to the chunk size, neither marker is one of them
+            static constexpr std::uintptr_t EMPTY = 0;
+            static constexpr std::uintptr_t REMOVED = 1;
+
+            struct Slot {
+                std::atomic<std::uintptr_t> key;
+                std::atomic<ModelMemoryResource*> owner;
+            };
+
+            static std::size_t position(std::uintptr_t key) noexcept {
+                auto slot = static_cast<std::uint64_t>(key / ModelMemoryResource::CHUNK_SIZE);
+                return static_cast<std::size_t>((slot * 0x9E3779B97F4A7C15ull) >> 48) % SLOTS;
+            }
+
+            std::mutex m_mutex;
+            std::size_t m_occupied = 0;     // slots which are not empty, removed ones included
+            std::atomic<std::size_t> m_live{0};
+            std::array<Slot, SLOTS> m_slots{};
+        };
+
+        // Constant initialized, so resources created during static initialization of other units find it ready
+        constinit ChunkRegistry g_chunks;
+
+        std::size_t aligned(std::size_t size) {
+            return (size + ModelMemoryResource::ALIGNMENT - 1) & ~(ModelMemoryResource::ALIGNMENT - 1);
+        }
+    }
+
+    ModelMemoryResource::ModelMemoryResource()
+    : m_generation{g_next_generation++}
+    , m_live{0}
+    {
+
+    }
+
+    ModelMemoryResource::~ModelMemoryResource() {
+        for (const auto* owned: {&m_used, &m_free}) {
+            for (const auto& chunk: *owned) {
+                for (std::size_t offset = 0; offset < chunk.size; offset += CHUNK_SIZE) {
+                    g_chunks.remove(chunk.memory.get() + offset);
+                }
+            }
+        }
+    }
+
+    ModelMemoryResource* ModelMemoryResource::owner(const void* pointer) noexcept {
+        return g_chunks.find(pointer);
+    }
+
+    void* ModelMemoryResource::allocate(std::size_t size) {
+        size = aligned(size);
+        auto generation = m_generation.load(std::memory_order_acquire);
+        auto& cursor = threadCursor(generation);
+        if (cursor.generation != generation or static_cast<std::size_t>(cursor.end - cursor.next) < size) {
+            auto chunk = takeChunk(size);
+            cursor = {generation, chunk.data(), chunk.data() + chunk.size()};
+        }
+        auto result = cursor.next;
+        cursor.next += size;
+        m_live.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    void ModelMemoryResource::deallocate(void* pointer) noexcept {
+        m_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void ModelMemoryResource::release() {
+        std::lock_guard lock(m_mutex);
+        if (m_live.load(std::memory_order_relaxed) != 0) {
+            throw std::logic_error("model memory released while " + std::to_string(live()) + " objects are alive");
+        }
+        std::move(m_used.begin(), m_used.end(), std::back_inserter(m_free));
+        m_used.clear();
+        m_generation.store(g_next_generation++, std::memory_order_release);
+    }
+
+    std::size_t ModelMemoryResource::bytesReserved() const {
+        std::lock_guard lock(m_mutex);
+        std::size_t result = 0;
+        for (const auto* chunks: {&m_used, &m_free}) {
+            for (const auto& chunk: *chunks) {
+                result += chunk.size;
+            }
+        }
+        return result;
+    }
+
+    std::span<std::byte> ModelMemoryResource::takeChunk(std::size_t size) {
+        std::lock_guard lock(m_mutex);
+        auto it = std::find_if(m_free.begin(), m_free.end(), [size](const Chunk& chunk) { return chunk.size >= size; });
+        if (it != m_free.end()) {
+            m_used.push_back(std::move(*it));
+            m_free.erase(it);
+        } else {
+            size = (size + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE;
+            ChunkMemory memory(static_cast<std::byte*>(::operator new(size, std::align_val_t{CHUNK_SIZE})));
+            std::size_t registered = 0;
+            try {
+                for (; registered < size; registered += CHUNK_SIZE) {
+                    g_chunks.add(memory.get() + registered, this);
+                }
+                m_used.push_back({std::move(memory), size});
+            }
+            catch (...) {
+                for (std::size_t offset = 0; offset < registered; offset += CHUNK_SIZE) {
+                    g_chunks.remove(memory.get() + offset);
+                }
+                throw;
+            }
+        }
+        return {m_used.back().memory.get(), m_used.back().size};
+    }
+
+}
@@ -0,0 +1,159 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/model_stats.hpp>
+
+#include <algorithm>
+#include <functional>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/utilities/tracing.hpp>
+
+#include "model_elements_impl.hpp"
+
+namespace arxml::helpers {
+
+    namespace {
+        // Heap memory of the string, nothing when it is short enough to be stored inside the object
+        std::size_t heapBytes(const std::string& value) {
+            auto* data = static_cast<const void*>(value.data());
+            auto* begin = static_cast<const void*>(&value);
+            auto* end = static_cast<const void*>(&value + 1);
+            bool inside = not std::less<const void*>{}(data, begin) and std::less<const void*>{}(data, end);
+            return inside ? 0 : value.capacity() + 1;
+        }
+
+        std::size_t nodeSize(model::EntryType type) {
+            switch (type) {
+                case model::EntryType::AUTOSAR: return sizeof(model::AutosarModel);
+                case model::EntryType::PACKAGES: return sizeof(model::AutosarPackages);
+                case model::EntryType::PACKAGE: return sizeof(model::AutosarPackage);
+                case model::EntryType::ELEMENTS: return sizeof(model::AutosarElements);
+                case model::EntryType::COMPOSITE_ELEMENT: return sizeof(model::CompositeAutosarElement);
+                case model::EntryType::NAMED_ELEMENT: return sizeof(model::NamedAutosarElement);
+                case model::EntryType::INTEGER_ELEMENT:
+                case model::EntryType::FLOATING_ELEMENT: return sizeof(model::NumberAutosarElement);
+                case model::EntryType::STRING_ELEMENT: return sizeof(model::StringAutosarElement);
+                case model::EntryType::REFERENCE_ELEMENT: return sizeof(model::ReferenceAutosarElement);
+                default: return 0;
+            }
+        }
+
+        template<typename Range>
+        std::size_t pointerBytes(const Range& range) {
+            return range.capacity() * sizeof(void*);
+        }
+    }
+
+    ModelStats::Footprint& ModelStats::Footprint::operator+=(const Footprint& other) noexcept {
+        nodes += other.nodes;
+        node_bytes += other.node_bytes;
+        string_bytes += other.string_bytes;
+        attribute_bytes += other.attribute_bytes;
+        vector_bytes += other.vector_bytes;
+        return *this;
+    }
+
+    class ModelStatsBuilder : public dfs::TraversalCallback {
+    public:
+        explicit ModelStatsBuilder(ModelStats& stats)
+        : m_stats{stats}
+        , m_current{&m_root}
+        {
+
+        }
+
+        dfs::VisitResult visit(const model::IAutosarModel& root) override {
+            addNode(root.getType(), nodeSize(root.getType()));
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        dfs::VisitResult visit(const model::IModelEntry& entry) override {
+            m_stats.m_files.push_back({entry.getEntryName(), {}});
+            m_current = &m_stats.m_files.back().footprint;
+            addNode(entry.getType(), sizeof(model::AutosarModelEntry));
+            m_current->string_bytes += heapBytes(m_stats.m_files.back().file) + heapBytes(entry.getXmlns())
+                                       + heapBytes(entry.getXmlnsXsi()) + heapBytes(entry.getSchemaLocation());
+            m_current->vector_bytes += pointerBytes(entry.getPackages());
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        void close(const model::IModelEntry& entry) override {
+            m_current = &m_root;
+        }
+
+        dfs::VisitResult visit(const model::IAutosarPackages& packages) override {
+            addNode(packages.getType(), nodeSize(packages.getType()));
+            m_current->vector_bytes += pointerBytes(packages.getPackages());
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+            addNode(package.getType(), nodeSize(package.getType()));
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override {
+            addNode(elements.getType(), nodeSize(elements.getType()));
+            m_current->vector_bytes += pointerBytes(elements.getElements());
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        dfs::VisitResult visit(const model::IAutosarElement& element) override {
+            auto type = element.getType();
+            addNode(type, nodeSize(type));
+            ++m_stats.m_tags[element.getTagId()];
+            if (element.isComposite()) {
+                m_current->vector_bytes += pointerBytes(dynamic_cast<const model::ICompositeAutosarElement&>(element).getSubElements());
+                return dfs::VisitResult::CONTINUE;
+            }
+            m_current->attribute_bytes += dynamic_cast<const model::ISimpleAutosarElement&>(element).getAttributes().bytes();
+            if (type == model::EntryType::STRING_ELEMENT or type == model::EntryType::REFERENCE_ELEMENT) {
+                m_current->string_bytes += heapBytes(dynamic_cast<const model::IStringAutosarElement&>(element).getText());
+            }
+            if (type == model::EntryType::REFERENCE_ELEMENT) {
+                const auto& segments = dynamic_cast<const model::IReferenceAutosarElement&>(element).getTargetSegments();
+                m_current->vector_bytes += segments.capacity() * sizeof(utilities::Symbol);
+            }
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        void finish() {
+            m_stats.m_total = m_root;
+            for (const auto& file: m_stats.m_files) {
+                m_stats.m_total += file.footprint;
+            }
+            m_stats.m_symbols = utilities::SymbolTable::instance().size();
+            m_stats.m_symbol_bytes = utilities::SymbolTable::instance().bytes();
+        }
+    private:
+        void addNode(model::EntryType type, std::size_t size) {
+            ++m_stats.m_types[static_cast<std::size_t>(type)];
+            ++m_current->nodes;
+            m_current->node_bytes += size;
+        }
+
+        ModelStats& m_stats;
+        ModelStats::Footprint m_root;
+        ModelStats::Footprint* m_current;
+    };
+
+    ModelStats ModelStats::collect(const model::IAutosarModel& model) {
+        ARXML_TRACE_SCOPE("model stats");
+        ModelStats stats;
+        ModelStatsBuilder builder(stats);
+        dfs::traverse_model(model, builder);
+        builder.finish();
+        return stats;
+    }
+
+    std::vector<std::pair<utilities::Symbol, std::size_t>> ModelStats::getTags() const {
+        std::vector<std::pair<utilities::Symbol, std::size_t>> result(m_tags.begin(), m_tags.end());
+        std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first.view() < rhs.first.view();
+        });
+        return result;
+    }
+
+}
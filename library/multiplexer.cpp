@@ -0,0 +1,67 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/dfs/multiplexer.hpp>
+
+namespace arxml::dfs {
+
+    void TraversalMultiplexer::addCallback(TraversalCallback& callback) {
+        m_callbacks.push_back({&callback, ACTIVE});
+    }
+
+    template<class Node>
+    VisitResult TraversalMultiplexer::forwardVisit(const Node& node) {
+        ++m_depth;
+        bool descend = false;
+        bool stopped = true;
+        for (auto& entry: m_callbacks) {
+            if (entry.muted_depth == ACTIVE) {
+                switch (entry.callback->visit(node)) {
+                    case VisitResult::CONTINUE:
+                        descend = true;
+                        break;
+                    case VisitResult::SKIP_CHILDREN:
+                        entry.muted_depth = m_depth;
+                        break;
+                    case VisitResult::STOP:
+                        entry.muted_depth = STOPPED;
+                        break;
+                }
+            }
+            stopped = stopped and entry.muted_depth == STOPPED;
+        }
+        if (stopped) {
+            return VisitResult::STOP;
+        }
+        return descend ? VisitResult::CONTINUE : VisitResult::SKIP_CHILDREN;
+    }
+
+    template<class Node>
+    void TraversalMultiplexer::forwardClose(const Node& node) {
+        for (auto& entry: m_callbacks) {
+            if (entry.muted_depth == m_depth) {
+                entry.muted_depth = ACTIVE;
+            }
+            if (entry.muted_depth == ACTIVE) {
+                entry.callback->close(node);
+            }
+        }
+        --m_depth;
+    }
+
+    VisitResult TraversalMultiplexer::visit(const model::IAutosarModel& root) { return forwardVisit(root); }
+    VisitResult TraversalMultiplexer::visit(const model::IModelEntry& root) { return forwardVisit(root); }
+    VisitResult TraversalMultiplexer::visit(const model::IAutosarPackages& packages) { return forwardVisit(packages); }
+    VisitResult TraversalMultiplexer::visit(const model::IAutosarPackage& package) { return forwardVisit(package); }
+    VisitResult TraversalMultiplexer::visit(const model::IAutosarElements& elements) { return forwardVisit(elements); }
+    VisitResult TraversalMultiplexer::visit(const model::IAutosarElement& element) { return forwardVisit(element); }
+
+    void TraversalMultiplexer::close(const model::IAutosarModel& root) { forwardClose(root); }
+    void TraversalMultiplexer::close(const model::IModelEntry& root) { forwardClose(root); }
+    void TraversalMultiplexer::close(const model::IAutosarPackages& packages) { forwardClose(packages); }
+    void TraversalMultiplexer::close(const model::IAutosarPackage& package) { forwardClose(package); }
+    void TraversalMultiplexer::close(const model::IAutosarElements& elements) { forwardClose(elements); }
+    void TraversalMultiplexer::close(const model::IAutosarElement& element) { forwardClose(element); }
+
+}
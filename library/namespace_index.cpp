@@ -0,0 +1,142 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/namespace_index.hpp>
+
+#include <algorithm>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/utilities/tracing.hpp>
+
+namespace arxml::helpers {
+
+    class NamespaceIndexBuilder : public dfs::TraversalCallback {
+    public:
+        explicit NamespaceIndexBuilder(NamespaceIndex& index)
+        : m_index{index}
+        , m_entry{nullptr}
+        {
+            m_index.m_nodes.push_back({NamespaceIndex::ROOT, {}, {}, {}});
+            m_stack.push_back(NamespaceIndex::ROOT);
+        }
+
+        dfs::VisitResult visit(const model::IModelEntry& entry) override {
+            m_entry = &entry;
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+            enter(package.getNameId()).definitions.push_back({m_entry, &package, nullptr});
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        void close(const model::IAutosarPackage& package) override {
+            m_stack.pop_back();
+        }
+
+        dfs::VisitResult visit(const model::IAutosarElement& element) override {
+            if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                auto& named = dynamic_cast<const model::INamedAutosarElement&>(element);
+                enter(named.getNameId()).definitions.push_back({m_entry, nullptr, &named});
+                return dfs::VisitResult::CONTINUE;
+            }
+            return element.isComposite() ? dfs::VisitResult::CONTINUE : dfs::VisitResult::SKIP_CHILDREN;
+        }
+
+        void close(const model::IAutosarElement& element) override {
+            if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                m_stack.pop_back();
+            }
+        }
+
+        void finish() {
+            for (std::uint32_t it = 0; it < m_index.m_nodes.size(); ++it) {
+                const auto& definitions = m_index.m_nodes[it].definitions;
+                auto elements = std::count_if(definitions.begin(), definitions.end(), [](const auto& definition) {
+                    return definition.element != nullptr;
+                });
+                if (definitions.size() < 2 or elements == 0) {
+                    continue;
+                }
+                auto hash = definitions.front().element ? definitions.front().element->getContentHash() : 0;
+                auto identical = hash != 0 and static_cast<std::size_t>(elements) == definitions.size()
+                                 and std::all_of(definitions.begin(), definitions.end(), [hash](const auto& definition) {
+                                     return definition.element->getContentHash() == hash;
+                                 });
+                m_index.m_duplicates.push_back({it, not identical});
+            }
+        }
+    private:
+        NamespaceIndex::Node& enter(utilities::Symbol name) {
+            auto node = m_index.addChild(m_stack.back(), name);
+            m_stack.push_back(node);
+            return m_index.m_nodes[node];
+        }
+
+        NamespaceIndex& m_index;
+        const model::IModelEntry* m_entry;
+        std::vector<std::uint32_t> m_stack;
+    };
+
+    NamespaceIndex NamespaceIndex::build(const model::IAutosarModel& model) {
+        ARXML_TRACE_SCOPE("namespace index build");
+        NamespaceIndex index;
+        NamespaceIndexBuilder builder(index);
+        dfs::traverse_model(model, builder);
+        builder.finish();
+        return index;
+    }
+
+    std::optional<std::uint32_t> NamespaceIndex::find(std::string_view path) const {
+        if (path == "/") {
+            return ROOT;
+        }
+        auto node = ROOT;
+        while (not path.empty()) {
+            if (path.front() != '/') {
+                return std::nullopt;
+            }
+            path.remove_prefix(1);
+            auto segment = path.substr(0, path.find('/'));
+            path.remove_prefix(segment.size());
+            auto name = utilities::SymbolTable::instance().find(segment);
+            auto next = name.empty() ? std::nullopt : child(node, name);
+            if (not next) {
+                return std::nullopt;
+            }
+            node = *next;
+        }
+        return node;
+    }
+
+    std::optional<std::uint32_t> NamespaceIndex::child(std::uint32_t node, utilities::Symbol name) const {
+        auto it = m_children.find({node, name.address()});
+        if (it == m_children.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::string NamespaceIndex::path(std::uint32_t node) const {
+        std::vector<utilities::Symbol> segments;
+        for (; node != ROOT; node = m_nodes[node].parent) {
+            segments.push_back(m_nodes[node].name);
+        }
+        std::string result;
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            result.append("/").append(it->view());
+        }
+        return result.empty() ? "/" : result;
+    }
+
+    std::uint32_t NamespaceIndex::addChild(std::uint32_t parent, utilities::Symbol name) {
+        auto [it, inserted] = m_children.try_emplace({parent, name.address()}, static_cast<std::uint32_t>(m_nodes.size()));
+        if (inserted) {
+            m_nodes.push_back({parent, name, {}, {}});
+            m_nodes[parent].children.push_back(it->second);
+        }
+        return it->second;
+    }
+
+}
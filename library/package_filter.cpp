@@ -0,0 +1,50 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/package_filter.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace arxml::utilities {
+
+    void PackageFilter::addPrefix(std::string_view prefix) {
+        if (not prefix.starts_with('/')) {
+            throw std::invalid_argument("Package prefix " + std::string(prefix) + " has to start with /");
+        }
+        std::vector<std::string> segments;
+        while (not prefix.empty()) {
+            prefix.remove_prefix(1);
+            auto end = std::min(prefix.find('/'), prefix.size());
+            if (end == 0 and prefix.empty()) {
+                break;
+            }
+            if (end == 0) {
+                throw std::invalid_argument("Package prefix contains an empty segment");
+            }
+            segments.emplace_back(prefix.substr(0, end));
+            prefix.remove_prefix(end);
+        }
+        m_prefixes.push_back(std::move(segments));
+    }
+
+    PackageFilter::Match PackageFilter::match(const std::vector<std::string_view>& package_path) const {
+        if (m_prefixes.empty()) {
+            return Match::INSIDE;
+        }
+        auto result = Match::NONE;
+        for (const auto& prefix: m_prefixes) {
+            auto common = std::min(prefix.size(), package_path.size());
+            if (not std::equal(prefix.begin(), prefix.begin() + common, package_path.begin())) {
+                continue;
+            }
+            if (prefix.size() <= package_path.size()) {
+                return Match::INSIDE;
+            }
+            result = Match::ANCESTOR;
+        }
+        return result;
+    }
+
+}
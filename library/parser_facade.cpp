@@ -6,7 +6,12 @@
 
 namespace arxml::utilities {
     void DefaultParserFacade::parse(const std::string& filename) {
-        io::FileSource source{filename};
-        m_parser.parseSource(filename, source);
+        auto source = io::open_file_source(filename);
+        m_parser.parseSource(filename, *source);
+    }
+
+    std::unique_ptr<model::IModelEntry> DefaultParserFacade::parseEntry(const std::string& filename) const {
+        auto source = io::open_file_source(filename);
+        return m_parser.parseEntry(filename, *source);
     }
 }
@@ -0,0 +1,152 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/path_trie.hpp>
+
+#include <algorithm>
+
+#include <arxml/utilities/tracing.hpp>
+
+namespace arxml::helpers {
+
+    PathTrie PathTrie::build(const model::IAutosarModel& model) {
+        return build(NamespaceIndex::build(model));
+    }
+
+    PathTrie PathTrie::build(const NamespaceIndex& index) {
+        ARXML_TRACE_SCOPE("path trie build");
+        PathTrie trie;
+        trie.m_nodes.reserve(index.size());
+        trie.m_nodes.push_back({{}, {}, ROOT, 0, 0});
+        // Index nodes in the order of the layout, breadth first
+        std::vector<std::uint32_t> order{NamespaceIndex::ROOT};
+        order.reserve(index.size());
+        for (std::uint32_t it = 0; it < order.size(); ++it) {
+            auto children = index[order[it]].children;
+            std::sort(children.begin(), children.end(), [&index](std::uint32_t lhs, std::uint32_t rhs) {
+                return index[lhs].name.view() < index[rhs].name.view();
+            });
+            trie.m_nodes[it].first_child = static_cast<std::uint32_t>(trie.m_nodes.size());
+            trie.m_nodes[it].children = static_cast<std::uint32_t>(children.size());
+            for (auto child: children) {
+                // Tag of the first definition, packages have none
+                const auto& first = index[child].definitions.front();
+                auto tag = first.element ? first.element->getTagId() : utilities::Symbol{};
+                order.push_back(child);
+                trie.m_nodes.push_back({index[child].name, tag, it, 0, 0});
+            }
+        }
+        return trie;
+    }
+
+    std::optional<std::uint32_t> PathTrie::find(std::string_view path) const {
+        if (path.empty() or path.front() != '/') {
+            return std::nullopt;
+        }
+        if (path == "/") {
+            return ROOT;
+        }
+        auto node = ROOT;
+        while (not path.empty()) {
+            path.remove_prefix(1);
+            auto segment = path.substr(0, path.find('/'));
+            path.remove_prefix(segment.size());
+            auto next = child(node, segment);
+            if (not next) {
+                return std::nullopt;
+            }
+            node = *next;
+        }
+        return node;
+    }
+
+    std::optional<std::uint32_t> PathTrie::child(std::uint32_t node, std::string_view name) const {
+        auto begin = m_nodes.begin() + m_nodes[node].first_child;
+        auto end = begin + m_nodes[node].children;
+        auto it = std::lower_bound(begin, end, name, [](const Node& child, std::string_view name) {
+            return child.name.view() < name;
+        });
+        if (it == end or it->name.view() != name) {
+            return std::nullopt;
+        }
+        return static_cast<std::uint32_t>(it - m_nodes.begin());
+    }
+
+    std::string PathTrie::path(std::uint32_t node) const {
+        std::vector<utilities::Symbol> segments;
+        for (; node != ROOT; node = m_nodes[node].parent) {
+            segments.push_back(m_nodes[node].name);
+        }
+        std::string result;
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            result.append("/").append(it->view());
+        }
+        return result.empty() ? "/" : result;
+    }
+
+    std::vector<PathTrie::Completion> PathTrie::complete(std::string_view prefix, std::size_t limit) const {
+        std::vector<Completion> result;
+        if (auto range = completionRange(prefix)) {
+            for (auto it = range->first; it < range->second and result.size() < limit; ++it) {
+                result.push_back({path(it), it});
+            }
+        }
+        return result;
+    }
+
+    std::vector<PathTrie::Completion> PathTrie::enumerate(std::string_view prefix, std::size_t limit) const {
+        std::vector<Completion> result;
+        auto range = completionRange(prefix);
+        if (not range or range->first == range->second) {
+            return result;
+        }
+        // Depth first with the path built incrementally; the stack holds the children still to visit
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> stack{*range};
+        std::vector<std::size_t> lengths;
+        std::string current = path(m_nodes[range->first].parent);
+        if (current == "/") {
+            current.clear();
+        }
+        while (not stack.empty() and result.size() < limit) {
+            auto& [next, end] = stack.back();
+            if (next == end) {
+                stack.pop_back();
+                if (not lengths.empty()) {
+                    current.resize(lengths.back());
+                    lengths.pop_back();
+                }
+                continue;
+            }
+            auto node = next++;
+            lengths.push_back(current.size());
+            current.append("/").append(m_nodes[node].name.view());
+            result.push_back({current, node});
+            stack.emplace_back(m_nodes[node].first_child, m_nodes[node].first_child + m_nodes[node].children);
+        }
+        return result;
+    }
+
+    std::optional<std::pair<std::uint32_t, std::uint32_t>> PathTrie::completionRange(std::string_view prefix) const {
+        auto separator = prefix.rfind('/');
+        if (separator == std::string_view::npos) {
+            return std::nullopt;
+        }
+        auto parent = find(separator == 0 ? "/" : prefix.substr(0, separator));
+        if (not parent) {
+            return std::nullopt;
+        }
+        auto partial = prefix.substr(separator + 1);
+        auto begin = m_nodes.begin() + m_nodes[*parent].first_child;
+        auto end = begin + m_nodes[*parent].children;
+        auto first = std::lower_bound(begin, end, partial, [](const Node& child, std::string_view partial) {
+            return child.name.view() < partial;
+        });
+        auto last = std::partition_point(first, end, [partial](const Node& child) {
+            return child.name.view().starts_with(partial);
+        });
+        return std::make_pair(static_cast<std::uint32_t>(first - m_nodes.begin()),
+                              static_cast<std::uint32_t>(last - m_nodes.begin()));
+    }
+
+}
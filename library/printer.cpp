@@ -4,8 +4,13 @@
 
 #include <arxml/printer.hpp>
 
-#include <iomanip>
+#include <array>
 #include <cassert>
+#include <charconv>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <vector>
 
 #include <arxml/dfs/traversal.hpp>
 
@@ -21,94 +26,102 @@ namespace arxml::printer {
 
         ~TreePrinterCallback() = default;
 
-        void visit(model::IAutosarModel &root) override;
-        void visit(model::IModelEntry &root) override;
-        void visit(model::IAutosarPackages &packages) override;
-        void visit(model::IAutosarPackage &package) override;
-        void visit(model::IAutosarElements &elements) override;
-        void visit(model::IAutosarElement &element) override;
-
-        void close(model::IModelEntry &root) override;
-        void close(model::IAutosarPackages &packages) override;
-        void close(model::IAutosarPackage &package) override;
-        void close(model::IAutosarElements &elements) override;
-        void close(model::IAutosarElement &element) override;
+        dfs::VisitResult visit(const model::IAutosarModel& root) override;
+        dfs::VisitResult visit(const model::IModelEntry& root) override;
+        dfs::VisitResult visit(const model::IAutosarPackages& packages) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+
+        void close(const model::IModelEntry& root) override;
+        void close(const model::IAutosarPackages& packages) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElements& elements) override;
+        void close(const model::IAutosarElement& element) override;
     private:
-        void visit(model::ISimpleAutosarElement& element);
-        void visit(model::ICompositeAutosarElement& element);
-        void visit(model::INamedAutosarElement& element);
+        void visit(const model::ISimpleAutosarElement& element);
+        void visit(const model::ICompositeAutosarElement& element);
+        void visit(const model::INamedAutosarElement& element);
 
         std::ostream& m_os;
         int m_tab_size;
         int m_indent_level;
     };
 
-    void TreePrinterCallback::visit(model::IAutosarModel& root) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IAutosarModel& root) {
         std::cout << "=> AUTOSAR\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::IModelEntry& model) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IModelEntry& model) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> AR-PACKAGES (from file: "
                   << model.getEntryName() << ")\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::IAutosarPackages &packages) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IAutosarPackages& packages) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> AR-PACKAGES\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::IAutosarPackage &package) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IAutosarPackage& package) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> AR-PACKAGE: " << package.getName() << "\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::IAutosarElements &elements) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IAutosarElements& elements) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> ELEMENTS\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::IAutosarElement &element) {
+    dfs::VisitResult TreePrinterCallback::visit(const model::IAutosarElement& element) {
         switch (element.getType()) {
             case model::EntryType::NAMED_ELEMENT:
-                visit(dynamic_cast<model::INamedAutosarElement &>(element));
+                visit(dynamic_cast<const model::INamedAutosarElement&>(element));
                 break;
             case model::EntryType::COMPOSITE_ELEMENT:
-                visit(dynamic_cast<model::ICompositeAutosarElement &>(element));
+                visit(dynamic_cast<const model::ICompositeAutosarElement&>(element));
                 break;
             case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT:
             case model::EntryType::INTEGER_ELEMENT:
             case model::EntryType::FLOATING_ELEMENT:
-                visit(dynamic_cast<model::ISimpleAutosarElement &>(element));
+                visit(dynamic_cast<const model::ISimpleAutosarElement&>(element));
                 break;
             default:
                 break; // INVALID BRANCH
         }
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void TreePrinterCallback::visit(model::ISimpleAutosarElement &element) {
+    void TreePrinterCallback::visit(const model::ISimpleAutosarElement& element) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> " << element.getTag() << " ";
-        const auto attributes = element.getAttributes();
+        const auto& attributes = element.getAttributes();
         if (not attributes.empty()) {
-            std::cout << "(" << attributes[0].first << ": " << attributes[0].second;
+            std::cout << "(" << attributes[0].name << ": " << attributes[0].value;
             for (int it = 1; it < attributes.size(); ++it) {
-                std::cout << ", " << attributes[it].first << ": " << attributes[it].second;
+                std::cout << ", " << attributes[it].name << ": " << attributes[it].value;
             }
             std::cout << ")";
         }
         std::cout << ": ";
         switch (element.getType()) {
             case model::EntryType::INTEGER_ELEMENT: {
-                std::cout << dynamic_cast<model::INumberAutosarElement &>(element).getInteger();
+                std::cout << dynamic_cast<const model::INumberAutosarElement&>(element).getInteger();
                 break;
             }
             case model::EntryType::FLOATING_ELEMENT: {
-                std::cout << dynamic_cast<model::INumberAutosarElement &>(element).getFloating();
+                std::cout << dynamic_cast<const model::INumberAutosarElement&>(element).getFloating();
                 break;
             }
-            case model::EntryType::STRING_ELEMENT: {
-                std::cout << dynamic_cast<model::IStringAutosarElement &>(element).getText();
+            case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT: {
+                std::cout << dynamic_cast<const model::IStringAutosarElement&>(element).getText();
                 break;
             }
             default:
@@ -118,41 +131,41 @@ namespace arxml::printer {
         std::cout << "\n";
     }
 
-    void TreePrinterCallback::visit(model::ICompositeAutosarElement &element) {
+    void TreePrinterCallback::visit(const model::ICompositeAutosarElement& element) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> " << element.getTag() << "\n";
         m_indent_level += 1;
     }
 
-    void TreePrinterCallback::visit(model::INamedAutosarElement &element) {
+    void TreePrinterCallback::visit(const model::INamedAutosarElement& element) {
         std::cout << std::setw(m_indent_level * m_tab_size) << "" << "=> " << element.getTag() << ": "
                   << element.getName() << "\n";
         m_indent_level += 1;
     }
 
-    void TreePrinterCallback::close(model::IModelEntry& root) {
+    void TreePrinterCallback::close(const model::IModelEntry& root) {
         m_indent_level -= 1;
     }
 
-    void TreePrinterCallback::close(model::IAutosarPackages &packages) {
+    void TreePrinterCallback::close(const model::IAutosarPackages& packages) {
         m_indent_level -= 1;
     }
 
-    void TreePrinterCallback::close(model::IAutosarPackage &package) {
+    void TreePrinterCallback::close(const model::IAutosarPackage& package) {
         m_indent_level -= 1;
     }
 
-    void TreePrinterCallback::close(model::IAutosarElements &elements) {
+    void TreePrinterCallback::close(const model::IAutosarElements& elements) {
         m_indent_level -= 1;
     }
 
-    void TreePrinterCallback::close(model::IAutosarElement &element) {
+    void TreePrinterCallback::close(const model::IAutosarElement& element) {
         if (element.isComposite()) {
             m_indent_level -= 1;
         }
     }
 
     template<class AutosarModelObject>
-    void generic_print(dfs::TraversalCallback& callback, AutosarModelObject& object) {
+    void generic_print(dfs::TraversalCallback& callback, const AutosarModelObject& object) {
         dfs::traverse_model(object, callback);
     }
 
@@ -162,30 +175,50 @@ namespace arxml::printer {
 
     }
 
-    void TreePrinter::print(model::IAutosarModel& root) {
+    void TreePrinter::print(const model::IAutosarModel& root) {
         generic_print(*m_callback, root);
     }
 
-    void TreePrinter::print(model::IModelEntry& root) {
+    void TreePrinter::print(const model::IModelEntry& root) {
         generic_print(*m_callback, root);
     }
 
-    void TreePrinter::print(model::IAutosarPackages& packages) {
+    void TreePrinter::print(const model::IAutosarPackages& packages) {
         generic_print(*m_callback, packages);
     }
 
-    void TreePrinter::print(model::IAutosarPackage& package) {
+    void TreePrinter::print(const model::IAutosarPackage& package) {
         generic_print(*m_callback, package);
     }
 
-    void TreePrinter::print(model::IAutosarElements& elements) {
+    void TreePrinter::print(const model::IAutosarElements& elements) {
         generic_print(*m_callback, elements);
     }
 
-    void TreePrinter::print(model::IAutosarElement& element) {
+    void TreePrinter::print(const model::IAutosarElement& element) {
         generic_print(*m_callback, element);
     }
 
+    namespace {
+        void write_escaped(std::ostream& os, std::string_view value) {
+            for (auto character: value) {
+                switch (character) {
+                    case '&': os << "&amp;"; break;
+                    case '<': os << "&lt;"; break;
+                    case '>': os << "&gt;"; break;
+                    case '"': os << "&quot;"; break;
+                    default: os << character;
+                }
+            }
+        }
+
+        void write_floating(std::ostream& os, double value) {
+            std::array<char, 32> buffer{};
+            auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            os << std::string_view(buffer.data(), end - buffer.data());
+        }
+    }
+
     class ArxmlPrinterCallback : public dfs::TraversalCallback {
     public:
         ArxmlPrinterCallback(std::ostream& os, int tab_size)
@@ -194,95 +227,103 @@ namespace arxml::printer {
                 , m_indent_level{0}
         {}
 
-        void visit(model::IAutosarModel &root) override;
-        void visit(model::IModelEntry &root) override;
-        void visit(model::IAutosarPackages &packages) override;
-        void visit(model::IAutosarPackage &package) override;
-        void visit(model::IAutosarElements &elements) override;
-        void visit(model::IAutosarElement &element) override;
-
-        void close(model::IModelEntry &root) override;
-        void close(model::IAutosarPackages &packages) override;
-        void close(model::IAutosarPackage &package) override;
-        void close(model::IAutosarElements &elements) override;
-        void close(model::IAutosarElement &element) override;
+        dfs::VisitResult visit(const model::IAutosarModel& root) override;
+        dfs::VisitResult visit(const model::IModelEntry& root) override;
+        dfs::VisitResult visit(const model::IAutosarPackages& packages) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+
+        void close(const model::IModelEntry& root) override;
+        void close(const model::IAutosarPackages& packages) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElements& elements) override;
+        void close(const model::IAutosarElement& element) override;
     private:
-        void visit(model::ISimpleAutosarElement& element);
-        void visit(model::ICompositeAutosarElement& element);
-        void visit(model::INamedAutosarElement& element);
+        void visit(const model::ISimpleAutosarElement& element);
+        void visit(const model::ICompositeAutosarElement& element);
+        void visit(const model::INamedAutosarElement& element);
 
         std::ostream& m_os;
         int m_tab_size;
         int m_indent_level;
     };
 
-    void ArxmlPrinterCallback::visit(model::IAutosarModel& root) {
-
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IAutosarModel& root) {
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::IModelEntry& model) {
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IModelEntry& model) {
         m_os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
              << "<AUTOSAR xmlns=\"" << model.getXmlns() << "\" xmlns:xsi=\"" << model.getXmlnsXsi()
              << "\" xsi:schemaLocation=\"" << model.getSchemaLocation() << "\">\n";
         m_indent_level += 1;
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<AR-PACKAGES>\n";
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<AR-PACKAGES>\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::IAutosarPackages &packages) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<AR-PACKAGES>\n";
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IAutosarPackages& packages) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<AR-PACKAGES>\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::IAutosarPackage &package) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<AR-PACKAGE>\n";
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IAutosarPackage& package) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<AR-PACKAGE>\n";
         m_indent_level += 1;
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<SHORT-NAME>";
+        write_escaped(m_os, package.getName());
+        m_os << "</SHORT-NAME>\n";
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::IAutosarElements &elements) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<ELEMENTS>\n";
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IAutosarElements& elements) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<ELEMENTS>\n";
         m_indent_level += 1;
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::IAutosarElement &element) {
+    dfs::VisitResult ArxmlPrinterCallback::visit(const model::IAutosarElement& element) {
         switch (element.getType()) {
             case model::EntryType::NAMED_ELEMENT:
-                visit(dynamic_cast<model::INamedAutosarElement &>(element));
+                visit(dynamic_cast<const model::INamedAutosarElement&>(element));
                 break;
             case model::EntryType::COMPOSITE_ELEMENT:
-                visit(dynamic_cast<model::ICompositeAutosarElement &>(element));
+                visit(dynamic_cast<const model::ICompositeAutosarElement&>(element));
                 break;
             case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT:
             case model::EntryType::INTEGER_ELEMENT:
             case model::EntryType::FLOATING_ELEMENT:
-                visit(dynamic_cast<model::ISimpleAutosarElement &>(element));
+                visit(dynamic_cast<const model::ISimpleAutosarElement&>(element));
                 break;
             default:
                 break; // INVALID BRANCH
         }
+        return dfs::VisitResult::CONTINUE;
     }
 
-    void ArxmlPrinterCallback::visit(model::ISimpleAutosarElement &element) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<" << element.getTag();
-        const auto attributes = element.getAttributes();
-        if (not attributes.empty()) {
-            for (const auto& [name, value]: attributes) {
-                m_os << " " << name << "=\"" << value;
-            }
+    void ArxmlPrinterCallback::visit(const model::ISimpleAutosarElement& element) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<" << element.getTag();
+        for (const auto& [name, value]: element.getAttributes()) {
+            m_os << " " << name << "=\"";
+            write_escaped(m_os, value);
             m_os << "\"";
         }
-        m_os << ">" << std::setw(0);
+        m_os << ">";
         switch (element.getType()) {
             case model::EntryType::INTEGER_ELEMENT: {
-                m_os << dynamic_cast<model::INumberAutosarElement &>(element).getInteger();
+                m_os << dynamic_cast<const model::INumberAutosarElement&>(element).getInteger();
                 break;
             }
             case model::EntryType::FLOATING_ELEMENT: {
-                m_os << dynamic_cast<model::INumberAutosarElement &>(element).getFloating();
+                write_floating(m_os, dynamic_cast<const model::INumberAutosarElement&>(element).getFloating());
                 break;
             }
-            case model::EntryType::STRING_ELEMENT: {
-                m_os << dynamic_cast<model::IStringAutosarElement &>(element).getText();
+            case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT: {
+                write_escaped(m_os, dynamic_cast<const model::IStringAutosarElement&>(element).getText());
                 break;
             }
             default:
@@ -290,44 +331,47 @@ namespace arxml::printer {
         }
     }
 
-    void ArxmlPrinterCallback::visit(model::ICompositeAutosarElement &element) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<" << element.getTag() << ">\n";
+    void ArxmlPrinterCallback::visit(const model::ICompositeAutosarElement& element) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<" << element.getTag() << ">\n";
         m_indent_level += 1;
     }
 
-    void ArxmlPrinterCallback::visit(model::INamedAutosarElement &element) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<" << element.getTag() << ">\n";
+    void ArxmlPrinterCallback::visit(const model::INamedAutosarElement& element) {
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<" << element.getTag() << ">\n";
         m_indent_level += 1;
-        m_os << std::setw(m_indent_level * m_tab_size) << " " <<  "<SHORT-NAME>" << element.getName() << "</SHORT-NAME>\n";
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "<SHORT-NAME>";
+        write_escaped(m_os, element.getName());
+        m_os << "</SHORT-NAME>\n";
     }
 
-    void ArxmlPrinterCallback::close(model::IModelEntry& root) {
+    void ArxmlPrinterCallback::close(const model::IModelEntry& root) {
         m_indent_level -= 1;
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "</AR-PACKAGES>\n";
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "</AR-PACKAGES>\n";
         m_indent_level -= 1;
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "</AUTOSAR>\n";
+        m_os << "</AUTOSAR>\n";
     }
 
-    void ArxmlPrinterCallback::close(model::IAutosarPackages &packages) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "</AR-PACKAGES>\n";
+    void ArxmlPrinterCallback::close(const model::IAutosarPackages& packages) {
         m_indent_level -= 1;
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "</AR-PACKAGES>\n";
     }
 
-    void ArxmlPrinterCallback::close(model::IAutosarPackage &package) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<AR-PACKAGE>\n";
+    void ArxmlPrinterCallback::close(const model::IAutosarPackage& package) {
         m_indent_level -= 1;
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "</AR-PACKAGE>\n";
     }
 
-    void ArxmlPrinterCallback::close(model::IAutosarElements &elements) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "<ELEMENTS>\n";
+    void ArxmlPrinterCallback::close(const model::IAutosarElements& elements) {
         m_indent_level -= 1;
+        m_os << std::setw(m_indent_level * m_tab_size) << "" << "</ELEMENTS>\n";
     }
 
-    void ArxmlPrinterCallback::close(model::IAutosarElement &element) {
-        m_os << std::setw(m_indent_level * m_tab_size) << " " << "</" << element.getTag() << ">\n";
+    void ArxmlPrinterCallback::close(const model::IAutosarElement& element) {
         if (element.isComposite()) {
             m_indent_level -= 1;
+            m_os << std::setw(m_indent_level * m_tab_size) << "";
         }
+        m_os << "</" << element.getTag() << ">\n";
     }
 
     ArxmlPrinter::ArxmlPrinter(std::ostream& stream, int indent)
@@ -336,31 +380,392 @@ namespace arxml::printer {
 
     }
 
-    void ArxmlPrinter::print(model::IAutosarModel& root) {
-        for (auto& [name, entry]: root.getModelUnits()) {
-            std::cout << "entry: " << name << std::endl;
-            generic_print(*m_callback, *entry);
+    void ArxmlPrinter::print(const model::IAutosarModel& root) {
+        for (const auto& entry: root.getModelUnits()) {
+            generic_print(*m_callback, entry);
         }
     }
 
-    void ArxmlPrinter::print(model::IModelEntry& root) {
+    void ArxmlPrinter::print(const model::IModelEntry& root) {
         generic_print(*m_callback, root);
     }
 
-    void ArxmlPrinter::print(model::IAutosarPackages& packages) {
+    void ArxmlPrinter::print(const model::IAutosarPackages& packages) {
         generic_print(*m_callback, packages);
     }
 
-    void ArxmlPrinter::print(model::IAutosarPackage& package) {
+    void ArxmlPrinter::print(const model::IAutosarPackage& package) {
         generic_print(*m_callback, package);
     }
 
-    void ArxmlPrinter::print(model::IAutosarElements& elements) {
+    void ArxmlPrinter::print(const model::IAutosarElements& elements) {
         generic_print(*m_callback, elements);
     }
 
-    void ArxmlPrinter::print(model::IAutosarElement& element) {
+    void ArxmlPrinter::print(const model::IAutosarElement& element) {
         generic_print(*m_callback, element);
     }
 
+    namespace {
+        // Collects output and writes it to the stream in large chunks
+        class BufferedWriter {
+        public:
+            static constexpr std::size_t CAPACITY = 64 * 1024;
+
+            explicit BufferedWriter(std::ostream& os)
+            : m_os{os}
+            {
+                m_buffer.reserve(CAPACITY);
+            }
+
+            void put(char character) {
+                m_buffer.push_back(character);
+                if (m_buffer.size() >= CAPACITY) {
+                    flush();
+                }
+            }
+
+            void put(std::string_view text) {
+                m_buffer.append(text);
+                if (m_buffer.size() >= CAPACITY) {
+                    flush();
+                }
+            }
+
+            void flush() {
+                m_os.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                m_buffer.clear();
+            }
+        private:
+            std::ostream& m_os;
+            std::string m_buffer;
+        };
+    }
+
+    class JsonPrinterCallback : public dfs::TraversalCallback {
+    public:
+        JsonPrinterCallback(std::ostream& os, JsonFormat format)
+        : m_writer{os}
+        , m_format{format}
+        , m_element_depth{0}
+        {
+
+        }
+
+        dfs::VisitResult visit(const model::IAutosarModel& root) override;
+        dfs::VisitResult visit(const model::IModelEntry& root) override;
+        dfs::VisitResult visit(const model::IAutosarPackages& packages) override;
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override;
+        dfs::VisitResult visit(const model::IAutosarElements& elements) override;
+        dfs::VisitResult visit(const model::IAutosarElement& element) override;
+
+        void close(const model::IAutosarModel& root) override;
+        void close(const model::IModelEntry& root) override;
+        void close(const model::IAutosarPackages& packages) override;
+        void close(const model::IAutosarPackage& package) override;
+        void close(const model::IAutosarElements& elements) override;
+        void close(const model::IAutosarElement& element) override;
+
+        void finish();
+    private:
+        [[nodiscard]] bool isDocument() const noexcept { return m_format == JsonFormat::JSON; }
+
+        void beginValue();
+        void openArray();
+        void closeArray();
+        void writeKey(std::string_view name);
+        void writeString(std::string_view value);
+        void writeValue(const model::ISimpleAutosarElement& element);
+
+        BufferedWriter m_writer;
+        JsonFormat m_format;
+        std::vector<bool> m_first;
+        utilities::SymbolPath m_path;
+        std::string m_file;
+        int m_element_depth;
+    };
+
+    void JsonPrinterCallback::beginValue() {
+        if (not m_first.empty()) {
+            if (not m_first.back()) {
+                m_writer.put(',');
+            }
+            m_first.back() = false;
+        }
+    }
+
+    void JsonPrinterCallback::openArray() {
+        m_writer.put('[');
+        m_first.push_back(true);
+    }
+
+    void JsonPrinterCallback::closeArray() {
+        m_first.pop_back();
+        m_writer.put(']');
+    }
+
+    void JsonPrinterCallback::writeKey(std::string_view name) {
+        writeString(name);
+        m_writer.put(':');
+    }
+
+    void JsonPrinterCallback::writeString(std::string_view value) {
+        constexpr std::string_view HEX = "0123456789abcdef";
+        m_writer.put('"');
+        std::size_t begin = 0;
+        for (std::size_t it = 0; it < value.size(); ++it) {
+            auto character = static_cast<unsigned char>(value[it]);
+            if (character >= 0x20 and character != '"' and character != '\\') {
+                continue;
+            }
+            m_writer.put(value.substr(begin, it - begin));
+            begin = it + 1;
+            switch (character) {
+                case '"': m_writer.put("\\\""); break;
+                case '\\': m_writer.put("\\\\"); break;
+                case '\n': m_writer.put("\\n"); break;
+                case '\r': m_writer.put("\\r"); break;
+                case '\t': m_writer.put("\\t"); break;
+                default: {
+                    char escaped[] = {'\\', 'u', '0', '0', HEX[character >> 4], HEX[character & 0xf]};
+                    m_writer.put(std::string_view(escaped, sizeof(escaped)));
+                }
+            }
+        }
+        m_writer.put(value.substr(begin));
+        m_writer.put('"');
+    }
+
+    void JsonPrinterCallback::writeValue(const model::ISimpleAutosarElement& element) {
+        std::array<char, 32> buffer{};
+        switch (element.getType()) {
+            case model::EntryType::INTEGER_ELEMENT: {
+                auto value = dynamic_cast<const model::INumberAutosarElement&>(element).getInteger();
+                auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+                m_writer.put(std::string_view(buffer.data(), end - buffer.data()));
+                break;
+            }
+            case model::EntryType::FLOATING_ELEMENT: {
+                auto value = dynamic_cast<const model::INumberAutosarElement&>(element).getFloating();
+                if (not std::isfinite(value)) {
+                    m_writer.put("null"); // not representable in JSON
+                    break;
+                }
+                auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+                m_writer.put(std::string_view(buffer.data(), end - buffer.data()));
+                break;
+            }
+            case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT: {
+                writeString(dynamic_cast<const model::IStringAutosarElement&>(element).getText());
+                break;
+            }
+            default:
+                assert(1 == 0); // invalid branch
+        }
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IAutosarModel& root) {
+        if (isDocument()) {
+            openArray();
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IModelEntry& root) {
+        m_file = root.getEntryName();
+        if (isDocument()) {
+            beginValue();
+            m_writer.put('{');
+            writeKey("file");
+            writeString(m_file);
+            m_writer.put(',');
+            writeKey("xmlns");
+            writeString(root.getXmlns());
+            m_writer.put(',');
+            writeKey("xmlns:xsi");
+            writeString(root.getXmlnsXsi());
+            m_writer.put(',');
+            writeKey("xsi:schemaLocation");
+            writeString(root.getSchemaLocation());
+            m_writer.put(',');
+            writeKey("packages");
+            openArray();
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IAutosarPackages& packages) {
+        if (isDocument()) {
+            openArray();
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IAutosarPackage& package) {
+        m_path.push(package.getNameId());
+        if (isDocument()) {
+            beginValue();
+            m_writer.put('{');
+            writeKey("name");
+            writeString(package.getName());
+            m_writer.put(',');
+            writeKey(package.getCollectionType() == model::CollectionType::ELEMENTS_COLLECTION ? "elements" : "packages");
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IAutosarElements& elements) {
+        if (isDocument()) {
+            openArray();
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    dfs::VisitResult JsonPrinterCallback::visit(const model::IAutosarElement& element) {
+        bool named = element.getType() == model::EntryType::NAMED_ELEMENT;
+        beginValue();
+        m_writer.put('{');
+        if (m_element_depth == 0 and not isDocument()) {
+            if (not m_file.empty()) {
+                writeKey("file");
+                writeString(m_file);
+                m_writer.put(',');
+            }
+            writeKey("path");
+            if (named) {
+                writeString(m_path.str(dynamic_cast<const model::INamedAutosarElement&>(element).getNameId()));
+            }
+            else {
+                writeString(m_path.str());
+            }
+            m_writer.put(',');
+        }
+        ++m_element_depth;
+        writeKey("tag");
+        writeString(element.getTagId().view());
+        switch (element.getType()) {
+            case model::EntryType::NAMED_ELEMENT:
+                m_writer.put(',');
+                writeKey("name");
+                writeString(dynamic_cast<const model::INamedAutosarElement&>(element).getNameId().view());
+                [[fallthrough]];
+            case model::EntryType::COMPOSITE_ELEMENT:
+                m_writer.put(',');
+                writeKey("children");
+                openArray();
+                break;
+            default: {
+                auto& simple = dynamic_cast<const model::ISimpleAutosarElement&>(element);
+                const auto& attributes = simple.getAttributes();
+                if (not attributes.empty()) {
+                    m_writer.put(',');
+                    writeKey("attributes");
+                    m_writer.put('{');
+                    for (std::size_t it = 0; it < attributes.size(); ++it) {
+                        if (it > 0) {
+                            m_writer.put(',');
+                        }
+                        writeKey(attributes[it].name);
+                        writeString(attributes[it].value);
+                    }
+                    m_writer.put('}');
+                }
+                m_writer.put(',');
+                writeKey("value");
+                writeValue(simple);
+            }
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    void JsonPrinterCallback::close(const model::IAutosarModel& root) {
+        if (isDocument()) {
+            closeArray();
+        }
+    }
+
+    void JsonPrinterCallback::close(const model::IModelEntry& root) {
+        if (isDocument()) {
+            closeArray();
+            m_writer.put('}');
+        }
+        m_file.clear();
+    }
+
+    void JsonPrinterCallback::close(const model::IAutosarPackages& packages) {
+        if (isDocument()) {
+            closeArray();
+        }
+    }
+
+    void JsonPrinterCallback::close(const model::IAutosarPackage& package) {
+        if (isDocument()) {
+            m_writer.put('}');
+        }
+        m_path.pop();
+    }
+
+    void JsonPrinterCallback::close(const model::IAutosarElements& elements) {
+        if (isDocument()) {
+            closeArray();
+        }
+    }
+
+    void JsonPrinterCallback::close(const model::IAutosarElement& element) {
+        if (element.isComposite()) {
+            closeArray();
+        }
+        m_writer.put('}');
+        --m_element_depth;
+        if (m_element_depth == 0 and not isDocument()) {
+            m_writer.put('\n');
+        }
+    }
+
+    void JsonPrinterCallback::finish() {
+        if (isDocument()) {
+            m_writer.put('\n');
+        }
+        m_writer.flush();
+    }
+
+    JsonPrinter::JsonPrinter(std::ostream& stream, JsonFormat format)
+    : m_callback{new JsonPrinterCallback{stream, format}}
+    {
+
+    }
+
+    JsonPrinter::~JsonPrinter() = default;
+
+    template<class AutosarModelObject>
+    void JsonPrinter::print_object(const AutosarModelObject& object) {
+        generic_print(*m_callback, object);
+        m_callback->finish();
+    }
+
+    void JsonPrinter::print(const model::IAutosarModel& root) {
+        print_object(root);
+    }
+
+    void JsonPrinter::print(const model::IModelEntry& root) {
+        print_object(root);
+    }
+
+    void JsonPrinter::print(const model::IAutosarPackages& packages) {
+        print_object(packages);
+    }
+
+    void JsonPrinter::print(const model::IAutosarPackage& package) {
+        print_object(package);
+    }
+
+    void JsonPrinter::print(const model::IAutosarElements& elements) {
+        print_object(elements);
+    }
+
+    void JsonPrinter::print(const model::IAutosarElement& element) {
+        print_object(element);
+    }
+
 }
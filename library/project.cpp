@@ -4,18 +4,125 @@
 
 #include <arxml/project.hpp>
 
+#include <algorithm>
 #include <filesystem>
 
+#include <arxml/utilities/diagnostics.hpp>
+#include <arxml/utilities/input_source.hpp>
+
 namespace arxml::project {
+
+    namespace {
+        struct Candidate {
+            std::string path;
+            std::uintmax_t size;
+            std::size_t order;
+        };
+
+        // Files found but not pushed yet, the largest of them goes first. The window is small, so parsing starts
+        // while the tree is still being walked.
+        class SchedulingWindow {
+        public:
+            explicit SchedulingWindow(utilities::BoundedQueue<std::string>& queue)
+            : m_queue{queue}
+            , m_added{0}
+            {
+
+            }
+
+            // False once the queue was closed by a consumer
+            bool add(std::string path, std::uintmax_t size) {
+                m_candidates.push_back({std::move(path), size, m_added++});
+                std::push_heap(m_candidates.begin(), m_candidates.end(), smaller);
+                return m_candidates.size() < ModelProject::SCHEDULING_WINDOW or pushLargest();
+            }
+
+            bool flush() {
+                while (not m_candidates.empty()) {
+                    if (not pushLargest()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        private:
+            // Equal sizes keep the order in which the files were found
+            static bool smaller(const Candidate& lhs, const Candidate& rhs) {
+                return lhs.size < rhs.size or (lhs.size == rhs.size and lhs.order > rhs.order);
+            }
+
+            bool pushLargest() {
+                std::pop_heap(m_candidates.begin(), m_candidates.end(), smaller);
+                auto path = std::move(m_candidates.back().path);
+                m_candidates.pop_back();
+                utilities::io::prefetch_file(path);
+                return m_queue.push(std::move(path));
+            }
+
+            utilities::BoundedQueue<std::string>& m_queue;
+            std::vector<Candidate> m_candidates;
+            std::size_t m_added;
+        };
+
+        bool globMatch(std::string_view pattern, std::string_view text) {
+            while (not pattern.empty()) {
+                if (pattern.starts_with("**/")) {
+                    pattern.remove_prefix(3);
+                    for (std::size_t it = 0; it <= text.size(); ++it) {
+                        if ((it == 0 or text[it - 1] == '/') and globMatch(pattern, text.substr(it))) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                if (pattern.starts_with("**")) {
+                    pattern.remove_prefix(2);
+                    for (std::size_t it = 0; it <= text.size(); ++it) {
+                        if (globMatch(pattern, text.substr(it))) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                if (pattern.front() == '*') {
+                    pattern.remove_prefix(1);
+                    for (std::size_t it = 0; it <= text.size(); ++it) {
+                        if (globMatch(pattern, text.substr(it))) {
+                            return true;
+                        }
+                        if (it < text.size() and text[it] == '/') {
+                            return false;
+                        }
+                    }
+                    return false;
+                }
+                if (text.empty() or (pattern.front() == '?' ? text.front() == '/' : pattern.front() != text.front())) {
+                    return false;
+                }
+                pattern.remove_prefix(1);
+                text.remove_prefix(1);
+            }
+            return text.empty();
+        }
+
+        bool matchesAny(const std::vector<std::string>& patterns, std::string_view path) {
+            auto slash = path.rfind('/');
+            auto name = slash == std::string_view::npos ? path : path.substr(slash + 1);
+            for (const auto& pattern: patterns) {
+                auto subject = pattern.find('/') == std::string::npos ? name : path;
+                if (globMatch(pattern, subject)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
     bool ModelProject::addDirectory(const std::string& directory) {
         if (not std::filesystem::exists(std::filesystem::path{directory})) {
             return false;
         }
-        for (const auto it: std::filesystem::recursive_directory_iterator(directory)) {
-            if (it.path().string().ends_with(".arxml")) {
-                m_files.emplace_back(std::move(it.path().string()));
-            }
-        }
+        m_directories.push_back(directory);
         return true;
     }
 
@@ -26,4 +133,51 @@ namespace arxml::project {
         m_files.push_back(file);
         return true;
     }
-}
\ No newline at end of file
+
+    bool ModelProject::isSelected(const std::string& relative_path) const {
+        if (not m_include.empty() and not matchesAny(m_include, relative_path)) {
+            return false;
+        }
+        return not matchesAny(m_exclude, relative_path);
+    }
+
+    void ModelProject::discover(utilities::BoundedQueue<std::string>& queue) const {
+        ARXML_TRACE_SCOPE("discovery");
+        try {
+            SchedulingWindow window(queue);
+            std::error_code error;
+            for (const auto& file: m_files) {
+                if (isSelected(std::filesystem::path(file).generic_string())) {
+                    auto size = std::filesystem::file_size(file, error);
+                    if (not window.add(file, error ? 0 : size)) {
+                        return;
+                    }
+                }
+            }
+            for (const auto& directory: m_directories) {
+                for (const auto& it: std::filesystem::recursive_directory_iterator(directory)) {
+                    auto file = it.path().string();
+                    auto compression = utilities::io::model_file_compression(file);
+                    if (not compression or not isSelected(it.path().lexically_relative(directory).generic_string())) {
+                        continue;
+                    }
+                    if (not utilities::io::is_compression_available(*compression)) {
+                        utilities::Diagnostics::instance().report({utilities::Severity::WARNING, file, 0,
+                            "library was built without support for this compression, file skipped"});
+                        continue;
+                    }
+                    auto size = it.file_size(error);
+                    if (not window.add(std::move(file), error ? 0 : size)) {
+                        return;
+                    }
+                }
+            }
+            window.flush();
+        }
+        catch (...) {
+            queue.close();
+            throw;
+        }
+        queue.close();
+    }
+}
@@ -0,0 +1,350 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/query.hpp>
+
+#include <stdexcept>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/values.hpp>
+
+namespace arxml::helpers {
+
+    namespace {
+        constexpr std::string_view SHORT_NAME = "SHORT-NAME";
+        constexpr std::string_view PACKAGE_TAG = "AR-PACKAGE";
+        constexpr std::string_view DELIMITERS = "/[]='\"";
+
+        using StateSet = std::uint64_t;
+
+        constexpr StateSet state(std::size_t index) {
+            return StateSet{1} << index;
+        }
+
+        class QueryParser {
+        public:
+            explicit QueryParser(std::string_view text)
+            : m_text{text}
+            , m_position{0}
+            {
+
+            }
+
+            std::vector<QueryStep> parseQuery() {
+                expect('/');
+                auto steps = parsePath();
+                if (m_position != m_text.size()) {
+                    error("unexpected character");
+                }
+                return steps;
+            }
+        private:
+            std::vector<QueryStep> parsePath() {
+                std::vector<QueryStep> steps;
+                steps.push_back(parseStep());
+                while (peek() == '/') {
+                    ++m_position;
+                    steps.push_back(parseStep());
+                }
+                if (steps.size() > CompiledQuery::MAX_STEPS) {
+                    error("too many steps");
+                }
+                return steps;
+            }
+
+            QueryStep parseStep() {
+                auto begin = m_position;
+                while (m_position < m_text.size() and DELIMITERS.find(m_text[m_position]) == std::string_view::npos) {
+                    ++m_position;
+                }
+                auto token = m_text.substr(begin, m_position - begin);
+                if (token.empty()) {
+                    error("empty step");
+                }
+                QueryStep step{QueryStep::Kind::NAME, {}, {}};
+                if (token == "**") {
+                    step.kind = QueryStep::Kind::ANY_DEPTH;
+                }
+                else if (token == "*") {
+                    step.kind = QueryStep::Kind::ANY;
+                }
+                else if (token.find('*') != std::string_view::npos) {
+                    error("wildcards have to fill the whole step");
+                }
+                else {
+                    step.name = utilities::intern(token);
+                }
+                while (peek() == '[') {
+                    if (step.kind == QueryStep::Kind::ANY_DEPTH) {
+                        error("predicates are not allowed after **");
+                    }
+                    step.predicates.push_back(parsePredicate());
+                }
+                return step;
+            }
+
+            QueryPredicate parsePredicate() {
+                expect('[');
+                QueryPredicate predicate{parsePath(), std::nullopt};
+                if (peek() == '=') {
+                    ++m_position;
+                    auto quote = peek();
+                    if (quote != '\'' and quote != '"') {
+                        error("expected quoted value");
+                    }
+                    ++m_position;
+                    auto end = m_text.find(quote, m_position);
+                    if (end == std::string_view::npos) {
+                        error("unterminated value");
+                    }
+                    predicate.value = std::string(m_text.substr(m_position, end - m_position));
+                    m_position = end + 1;
+                }
+                expect(']');
+                return predicate;
+            }
+
+            [[nodiscard]] char peek() const {
+                return m_position < m_text.size() ? m_text[m_position] : '\0';
+            }
+
+            void expect(char character) {
+                if (peek() != character) {
+                    error(std::string("expected '") + character + "'");
+                }
+                ++m_position;
+            }
+
+            [[noreturn]] void error(const std::string& message) const {
+                throw std::invalid_argument("Invalid query " + std::string(m_text) + " at position "
+                                            + std::to_string(m_position) + ": " + message);
+            }
+
+            std::string_view m_text;
+            std::size_t m_position;
+        };
+
+        using Node = QueryMatcher::Node;
+
+        // An empty short name is interned as well, such nodes are still matched and listed by their tag
+        utilities::Symbol nameOf(utilities::Symbol name) {
+            return name.view().empty() ? utilities::Symbol{} : name;
+        }
+
+        Node makeNode(const model::IAutosarPackage& package) {
+            static const auto package_tag = utilities::intern(PACKAGE_TAG);
+            return {package, nameOf(package.getNameId()), package_tag};
+        }
+
+        Node makeNode(const model::IAutosarElement& element) {
+            utilities::Symbol name;
+            if (element.getType() == model::EntryType::NAMED_ELEMENT) {
+                name = nameOf(dynamic_cast<const model::INamedAutosarElement&>(element).getNameId());
+            }
+            return {element, name, element.getTagId()};
+        }
+
+        bool isSimple(const model::IAutosarModelObject& object) {
+            auto type = object.getType();
+            return type == model::EntryType::INTEGER_ELEMENT or type == model::EntryType::FLOATING_ELEMENT
+                or type == model::EntryType::STRING_ELEMENT or type == model::EntryType::REFERENCE_ELEMENT;
+        }
+
+        std::string valueOf(const Node& node) {
+            if (isSimple(node.object)) {
+                return simple_value(dynamic_cast<const model::ISimpleAutosarElement&>(node.object));
+            }
+            return {};
+        }
+
+        template<class Function>
+        bool anyChild(const model::IAutosarModelObject& object, Function&& function) {
+            switch (object.getType()) {
+                case model::EntryType::PACKAGE: {
+                    auto& package = dynamic_cast<const model::IAutosarPackage&>(object);
+                    if (package.getCollectionType() == model::CollectionType::ELEMENTS_COLLECTION) {
+                        for (auto& element: package.getElements().getElements()) {
+                            if (function(makeNode(element))) {
+                                return true;
+                            }
+                        }
+                    }
+                    else {
+                        for (auto& subpackage: package.getPackages().getPackages()) {
+                            if (function(makeNode(subpackage))) {
+                                return true;
+                            }
+                        }
+                    }
+                    return false;
+                }
+                case model::EntryType::NAMED_ELEMENT:
+                case model::EntryType::COMPOSITE_ELEMENT: {
+                    for (auto& child: dynamic_cast<const model::ICompositeAutosarElement&>(object).getSubElements()) {
+                        if (function(makeNode(child))) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        StateSet closure(const std::vector<QueryStep>& steps, StateSet states) {
+            for (std::size_t it = 0; it < steps.size(); ++it) {
+                if ((states & state(it)) and steps[it].kind == QueryStep::Kind::ANY_DEPTH) {
+                    states |= state(it + 1);
+                }
+            }
+            return states;
+        }
+
+        bool holds(const QueryPredicate& predicate, const Node& node);
+
+        bool matches(const QueryStep& step, const Node& node) {
+            switch (step.kind) {
+                case QueryStep::Kind::ANY:
+                    break;
+                case QueryStep::Kind::NAME:
+                    if (step.name != node.tag and (node.name.empty() or step.name != node.name)) {
+                        return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+            for (const auto& predicate: step.predicates) {
+                if (not holds(predicate, node)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // States reached after consuming the node
+        StateSet advance(const std::vector<QueryStep>& steps, StateSet states, const Node& node) {
+            StateSet next = 0;
+            for (std::size_t it = 0; it < steps.size(); ++it) {
+                if (not (states & state(it))) {
+                    continue;
+                }
+                if (steps[it].kind == QueryStep::Kind::ANY_DEPTH) {
+                    next |= state(it);
+                }
+                else if (matches(steps[it], node)) {
+                    next |= state(it + 1);
+                }
+            }
+            return closure(steps, next);
+        }
+
+        // SHORT-NAME is not a model element, it is matched only by a literal last step
+        bool acceptsShortName(const std::vector<QueryStep>& steps, StateSet states) {
+            static const auto short_name = utilities::intern(SHORT_NAME);
+            const auto& last = steps.back();
+            return (states & state(steps.size() - 1)) and last.kind == QueryStep::Kind::NAME
+                   and last.name == short_name and last.predicates.empty();
+        }
+
+        bool matchesBelow(const QueryPredicate& predicate, StateSet states, const Node& node) {
+            const auto& steps = predicate.path;
+            if (not node.name.empty() and acceptsShortName(steps, states)
+                and (not predicate.value or *predicate.value == node.name.view())) {
+                return true;
+            }
+            return anyChild(node.object, [&](const Node& child) {
+                auto next = advance(steps, states, child);
+                if ((next & state(steps.size())) and (not predicate.value or *predicate.value == valueOf(child))) {
+                    return true;
+                }
+                return (next & ~state(steps.size())) != 0 and matchesBelow(predicate, next, child);
+            });
+        }
+
+        bool holds(const QueryPredicate& predicate, const Node& node) {
+            return matchesBelow(predicate, closure(predicate.path, state(0)), node);
+        }
+
+        std::string joinPath(const std::vector<utilities::Symbol>& path, utilities::Symbol last) {
+            std::string result;
+            for (const auto& segment: path) {
+                result.append("/").append(segment.view());
+            }
+            return result.append("/").append(last.view());
+        }
+    }
+
+    CompiledQuery::CompiledQuery(std::string text, std::vector<QueryStep> steps)
+    : m_text{std::move(text)}
+    , m_steps{std::move(steps)}
+    {
+
+    }
+
+    CompiledQuery CompiledQuery::compile(std::string_view query) {
+        QueryParser parser(query);
+        auto steps = parser.parseQuery();
+        return {std::string(query), std::move(steps)};
+    }
+
+    QueryMatcher::QueryMatcher(const CompiledQuery& query, std::vector<QueryMatch>& result)
+    : m_query{query}
+    , m_result{result}
+    , m_states{closure(query.getSteps(), state(0))}
+    {
+
+    }
+
+    dfs::VisitResult QueryMatcher::visit(const model::IAutosarPackage& package) {
+        return enter(makeNode(package));
+    }
+
+    dfs::VisitResult QueryMatcher::visit(const model::IAutosarElement& element) {
+        return enter(makeNode(element));
+    }
+
+    void QueryMatcher::close(const model::IAutosarPackage& package) {
+        leave();
+    }
+
+    void QueryMatcher::close(const model::IAutosarElement& element) {
+        leave();
+    }
+
+    dfs::VisitResult QueryMatcher::enter(const Node& node) {
+        const auto& steps = m_query.getSteps();
+        auto segment = node.name.empty() ? node.tag : node.name;
+        auto next = advance(steps, m_states.back(), node);
+        if (next & state(steps.size())) {
+            m_result.push_back({joinPath(m_path, segment), node.object, valueOf(node)});
+        }
+        if (not node.name.empty() and acceptsShortName(steps, next)) {
+            m_result.push_back({joinPath(m_path, segment) + "/" + std::string(SHORT_NAME), node.object,
+                                std::string(node.name.view())});
+        }
+        m_states.push_back(next);
+        m_path.push_back(segment);
+        bool alive = (next & ~state(steps.size())) != 0;
+        return alive ? dfs::VisitResult::CONTINUE : dfs::VisitResult::SKIP_CHILDREN;
+    }
+
+    void QueryMatcher::leave() {
+        m_states.pop_back();
+        m_path.pop_back();
+    }
+
+    std::vector<QueryMatch> run_query(const model::IAutosarModel& model, std::string_view query) {
+        return run_query(model, CompiledQuery::compile(query));
+    }
+
+    std::vector<QueryMatch> run_query(const model::IAutosarModel& model, const CompiledQuery& query) {
+        std::vector<QueryMatch> result;
+        QueryMatcher matcher(query, result);
+        dfs::traverse_model(model, matcher);
+        return result;
+    }
+
+}
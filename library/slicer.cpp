@@ -0,0 +1,170 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/slicer.hpp>
+
+#include <deque>
+
+#include <arxml/dfs/traversal.hpp>
+
+namespace arxml::helpers {
+
+    namespace {
+        std::string toString(const std::vector<std::string>& vec) {
+            std::string result;
+            for (const auto& part: vec) {
+                result.append("/").append(part);
+            }
+            return result;
+        }
+
+        class ReferenceCollector : public dfs::TraversalCallback {
+        public:
+            explicit ReferenceCollector(std::unordered_map<std::string, std::vector<std::string>>& references)
+            : m_references{references}
+            , m_current{nullptr}
+            , m_depth{0}
+            {
+
+            }
+
+            dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+                m_path.push_back(package.getName());
+                return dfs::VisitResult::CONTINUE;
+            }
+            void close(const model::IAutosarPackage& package) override { m_path.pop_back(); }
+            dfs::VisitResult visit(const model::IAutosarElement& element) override;
+            void close(const model::IAutosarElement& element) override { --m_depth; }
+        private:
+            std::unordered_map<std::string, std::vector<std::string>>& m_references;
+            std::vector<std::string>* m_current;
+            std::vector<std::string> m_path;
+            int m_depth;
+        };
+
+        dfs::VisitResult ReferenceCollector::visit(const model::IAutosarElement& element) {
+            if (m_depth == 0) {
+                auto& named = dynamic_cast<const model::INamedAutosarElement&>(element);
+                m_current = &m_references[toString(m_path) + "/" + named.getName()];
+            }
+            ++m_depth;
+            if (element.getType() == model::EntryType::REFERENCE_ELEMENT) {
+                m_current->push_back(dynamic_cast<const model::IReferenceAutosarElement&>(element).getText());
+            }
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        std::unique_ptr<model::IAutosarPackage> slicePackage(model::IAutosarPackage& package,
+                                                             const std::string& parent_path,
+                                                             const std::set<std::string>& reachable,
+                                                             const utilities::parser::IModelComponentFactory& factory) {
+            auto path = parent_path + "/" + package.getName();
+            switch (package.getCollectionType()) {
+                case model::CollectionType::ELEMENTS_COLLECTION: {
+                    auto elements = factory.createElements();
+                    auto& source = package.getElements().getElements();
+                    for (auto& element: source) {
+                        if (reachable.contains(path + "/" + element->getName())) {
+                            elements->addElement(std::move(element));
+                        }
+                    }
+                    std::erase_if(source, [](const auto& element) { return element == nullptr; });
+                    if (elements->getElements().empty()) {
+                        return nullptr;
+                    }
+                    return factory.createPackage(package.getName(), std::move(elements));
+                }
+                case model::CollectionType::PACKAGES_COLLECTION: {
+                    auto packages = factory.createPackages();
+                    for (auto& subpackage: package.getPackages().getPackages()) {
+                        auto sliced = slicePackage(*subpackage, path, reachable, factory);
+                        if (sliced) {
+                            packages->addPackage(std::move(sliced));
+                        }
+                    }
+                    if (packages->getPackages().empty()) {
+                        return nullptr;
+                    }
+                    return factory.createPackage(package.getName(), std::move(packages));
+                }
+                default:
+                    return nullptr; // INVALID BRANCH
+            }
+        }
+    }
+
+    ModelSlicer::ModelSlicer(model::IAutosarModel& model)
+    : m_model{model}
+    {
+        ReferenceCollector collector(m_references);
+        dfs::traverse_model(m_model, collector);
+    }
+
+    const std::string* ModelSlicer::resolve(const std::string& path) const {
+        auto candidate = path;
+        while (not candidate.empty()) {
+            auto found = m_references.find(candidate);
+            if (found != m_references.end()) {
+                return &found->first;
+            }
+            auto separator = candidate.rfind('/');
+            if (separator == std::string::npos) {
+                break;
+            }
+            candidate.erase(separator);
+        }
+        return nullptr;
+    }
+
+    std::set<std::string> ModelSlicer::collectReachable(const std::vector<std::string>& roots) const {
+        std::set<std::string> result;
+        std::deque<const std::string*> pending;
+        for (const auto& root: roots) {
+            if (auto element = resolve(root)) {
+                pending.push_back(element);
+                continue;
+            }
+            auto prefix = root + "/";
+            for (const auto& [path, references]: m_references) {
+                if (path.starts_with(prefix)) {
+                    pending.push_back(&path);
+                }
+            }
+        }
+        while (not pending.empty()) {
+            auto current = pending.front();
+            pending.pop_front();
+            if (not result.insert(*current).second) {
+                continue;
+            }
+            for (const auto& reference: m_references.at(*current)) {
+                if (auto target = resolve(reference)) {
+                    pending.push_back(target);
+                }
+            }
+        }
+        return result;
+    }
+
+    std::unique_ptr<model::IAutosarModel> ModelSlicer::slice(const std::vector<std::string>& roots,
+                                                             const utilities::parser::IModelComponentFactory& factory) {
+        auto reachable = collectReachable(roots);
+        auto result = factory.createRoot();
+        for (auto& [name, entry]: m_model.getModelUnits()) {
+            auto sliced_entry = factory.createModelEntry(name, entry->getXmlns(), entry->getXmlnsXsi(),
+                                                         entry->getSchemaLocation());
+            for (auto& package: entry->getPackages()) {
+                auto sliced = slicePackage(*package, "", reachable, factory);
+                if (sliced) {
+                    sliced_entry->addPackage(std::move(sliced));
+                }
+            }
+            if (not sliced_entry->getPackages().empty()) {
+                result->registerModelEntry(name, std::move(sliced_entry));
+            }
+        }
+        return result;
+    }
+
+}
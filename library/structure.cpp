@@ -0,0 +1,59 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/structure.hpp>
+
+#include <algorithm>
+
+namespace arxml::helpers {
+
+    StructureEntry& StructureCollector::entryFor(const model::IAutosarElement& element) {
+        auto tag = element.getTagId();
+        if (m_stack.empty()) {
+            auto& entry = m_entries[tag.view()];
+            entry.tag = tag;
+            return entry;
+        }
+        auto& entries = m_stack.back()->entries;
+        auto found = std::find_if(entries.begin(), entries.end(), [tag](const auto& entry) {
+            return entry->tag == tag;
+        });
+        if (found != entries.end()) {
+            return **found;
+        }
+        entries.emplace_back(std::make_unique<StructureEntry>(tag));
+        return *entries.back();
+    }
+
+    dfs::VisitResult StructureCollector::visit(const model::IAutosarElement& element) {
+        static const auto short_name_tag = utilities::intern("SHORT-NAME");
+        auto& entry = entryFor(element);
+        entry.counter += 1;
+        m_stack.push_back(&entry);
+        switch (element.getType()) {
+            case model::EntryType::REFERENCE_ELEMENT: {
+                auto destination = dynamic_cast<const model::IReferenceAutosarElement&>(element).getDestination();
+                if (std::find(entry.referenced_types.begin(), entry.referenced_types.end(), destination)
+                    == entry.referenced_types.end()) {
+                    entry.referenced_types.push_back(destination);
+                }
+                break;
+            }
+            case model::EntryType::NAMED_ELEMENT: {
+                if (entry.entries.empty()) {
+                    entry.entries.emplace_back(std::make_unique<StructureEntry>(short_name_tag, 1));
+                }
+                entry.entries[0]->counter += 1;
+                break;
+            }
+            default: break;
+        }
+        return dfs::VisitResult::CONTINUE;
+    }
+
+    void StructureCollector::close(const model::IAutosarElement& element) {
+        m_stack.pop_back();
+    }
+
+}
@@ -0,0 +1,90 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/symbols.hpp>
+
+#include <mutex>
+
+namespace arxml::utilities {
+
+    namespace {
+        std::uint64_t mix(std::uint64_t value) {
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
+        }
+    }
+
+    SymbolTable& SymbolTable::instance() {
+        static SymbolTable table;
+        return table;
+    }
+
+    Symbol SymbolTable::intern(std::string_view value) {
+        {
+            std::shared_lock lock(m_mutex);
+            auto found = m_index.find(value);
+            if (found != m_index.end()) {
+                return Symbol(found->second);
+            }
+        }
+        std::unique_lock lock(m_mutex);
+        auto found = m_index.find(value);
+        if (found != m_index.end()) {
+            return Symbol(found->second);
+        }
+        const auto& stored = m_storage.emplace_back(value);
+        m_index.emplace(stored, &stored);
+        m_bytes += stored.capacity() + sizeof(std::string);
+        return Symbol(&stored);
+    }
+
+    Symbol SymbolTable::find(std::string_view value) const {
+        std::shared_lock lock(m_mutex);
+        auto found = m_index.find(value);
+        return found != m_index.end() ? Symbol(found->second) : Symbol();
+    }
+
+    std::size_t SymbolTable::size() const {
+        std::shared_lock lock(m_mutex);
+        return m_storage.size();
+    }
+
+    std::size_t SymbolTable::bytes() const {
+        std::shared_lock lock(m_mutex);
+        return m_bytes;
+    }
+
+    SymbolPath SymbolPath::parse(std::string_view path) {
+        auto& table = SymbolTable::instance();
+        SymbolPath result;
+        while (not path.empty()) {
+            auto end = path.find('/');
+            if (end != 0) {
+                result.push(table.find(path.substr(0, end)));
+            }
+            path = end == std::string_view::npos ? std::string_view{} : path.substr(end + 1);
+        }
+        return result;
+    }
+
+    void SymbolPath::push(Symbol segment) {
+        auto hash = mix(prefixHash(size()) ^ reinterpret_cast<std::uintptr_t>(segment.address()));
+        m_segments.push_back(segment);
+        m_hashes.push_back(hash);
+    }
+
+    std::string SymbolPath::str() const {
+        std::string result;
+        for (auto segment: m_segments) {
+            result.append("/").append(segment.view());
+        }
+        return result;
+    }
+
+    std::string SymbolPath::str(Symbol last) const {
+        return str().append("/").append(last.view());
+    }
+
+}
@@ -0,0 +1,230 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/text_index.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/utilities/tracing.hpp>
+
+namespace arxml::helpers {
+
+    namespace {
+        constexpr auto NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+
+        // Orders suffixes by their first pattern length characters only
+        struct PrefixLess {
+            const char* data;
+            std::size_t size;
+
+            bool operator()(std::uint32_t suffix, std::string_view pattern) const {
+                return std::strncmp(data + suffix, pattern.data(), size) < 0;
+            }
+
+            bool operator()(std::string_view pattern, std::uint32_t suffix) const {
+                return std::strncmp(pattern.data(), data + suffix, size) < 0;
+            }
+        };
+
+        // Elements with a node in the index, visit enters and close leaves exactly these
+        bool hasNode(model::EntryType type) {
+            switch (type) {
+                case model::EntryType::NAMED_ELEMENT:
+                case model::EntryType::COMPOSITE_ELEMENT:
+                case model::EntryType::STRING_ELEMENT:
+                case model::EntryType::REFERENCE_ELEMENT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    class TextIndexBuilder : public dfs::TraversalCallback {
+    public:
+        explicit TextIndexBuilder(TextIndex& index)
+        : m_index{index}
+        {
+
+        }
+
+        dfs::VisitResult visit(const model::IAutosarPackage& package) override {
+            auto node = enter(package.getNameId());
+            addDocument(node, package.getName());
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        void close(const model::IAutosarPackage& package) override {
+            m_stack.pop_back();
+        }
+
+        dfs::VisitResult visit(const model::IAutosarElement& element) override {
+            auto type = element.getType();
+            if (not hasNode(type)) {
+                return dfs::VisitResult::CONTINUE;
+            }
+            if (type == model::EntryType::NAMED_ELEMENT) {
+                auto name = dynamic_cast<const model::INamedAutosarElement&>(element).getNameId();
+                addDocument(enter(name), name.view());
+            } else {
+                auto node = enter(element.getTagId());
+                if (type != model::EntryType::COMPOSITE_ELEMENT) {
+                    addDocument(node, dynamic_cast<const model::IStringAutosarElement&>(element).getText());
+                }
+            }
+            return dfs::VisitResult::CONTINUE;
+        }
+
+        void close(const model::IAutosarElement& element) override {
+            if (hasNode(element.getType())) {
+                m_stack.pop_back();
+            }
+        }
+
+        void finish() {
+            compactPostings();
+            sortSuffixes();
+        }
+    private:
+        std::uint32_t enter(utilities::Symbol segment) {
+            auto node = static_cast<std::uint32_t>(m_index.m_nodes.size());
+            m_index.m_nodes.push_back({m_stack.empty() ? NO_PARENT : m_stack.back(), segment});
+            m_stack.push_back(node);
+            return node;
+        }
+
+        void addDocument(std::uint32_t node, std::string_view text) {
+            if (text.empty() or text.find('\0') != std::string_view::npos) {
+                return;
+            }
+            auto [it, inserted] = m_texts.try_emplace(text, static_cast<std::uint32_t>(m_index.m_text_offsets.size()));
+            if (inserted) {
+                if (m_index.m_texts.size() + text.size() + 1 > NO_PARENT) {
+                    throw std::length_error("Text index exceeds 4 GiB");
+                }
+                m_index.m_text_offsets.push_back(static_cast<std::uint32_t>(m_index.m_texts.size()));
+                m_index.m_texts.append(text).push_back('\0');
+                m_documents_by_text.emplace_back();
+            }
+            m_documents_by_text[it->second].push_back(static_cast<std::uint32_t>(m_index.m_documents.size()));
+            m_index.m_documents.push_back({node, it->second});
+        }
+
+        void compactPostings() {
+            m_index.m_posting_offsets.reserve(m_documents_by_text.size() + 1);
+            m_index.m_posting_offsets.push_back(0);
+            m_index.m_postings.reserve(m_index.m_documents.size());
+            for (const auto& documents: m_documents_by_text) {
+                m_index.m_postings.insert(m_index.m_postings.end(), documents.begin(), documents.end());
+                m_index.m_posting_offsets.push_back(static_cast<std::uint32_t>(m_index.m_postings.size()));
+            }
+        }
+
+        // Texts are terminated with '\0', so comparing suffixes never crosses into the next text. Suffixes
+        // are sorted by their first eight characters packed into an integer, most comparisons end there.
+        void sortSuffixes() {
+            const auto& texts = m_index.m_texts;
+            const auto* data = texts.data();
+            std::vector<std::pair<std::uint64_t, std::uint32_t>> keys;
+            keys.reserve(texts.size() - m_index.m_text_offsets.size());
+            for (std::uint32_t it = 0; it < texts.size(); ++it) {
+                if (texts[it] != '\0') {
+                    keys.emplace_back(prefixKey(data + it), it);
+                }
+            }
+            std::sort(keys.begin(), keys.end(), [data](const auto& lhs, const auto& rhs) {
+                if (lhs.first != rhs.first) {
+                    return lhs.first < rhs.first;
+                }
+                // Equal keys ending within the prefix are equal suffixes
+                return (lhs.first & 0xff) != 0 and std::strcmp(data + lhs.second + 8, data + rhs.second + 8) < 0;
+            });
+            m_index.m_suffixes.reserve(keys.size());
+            for (const auto& [key, suffix]: keys) {
+                m_index.m_suffixes.push_back(suffix);
+            }
+        }
+
+        static std::uint64_t prefixKey(const char* suffix) {
+            std::uint64_t key = 0;
+            std::size_t it = 0;
+            for (; it < 8 and suffix[it] != '\0'; ++it) {
+                key = (key << 8) | static_cast<unsigned char>(suffix[it]);
+            }
+            return key << (8 * (8 - it));
+        }
+
+        TextIndex& m_index;
+        std::vector<std::uint32_t> m_stack;
+        std::unordered_map<std::string_view, std::uint32_t> m_texts;
+        std::vector<std::vector<std::uint32_t>> m_documents_by_text;
+    };
+
+    TextIndex TextIndex::build(const model::IAutosarModel& model) {
+        ARXML_TRACE_SCOPE("text index build");
+        TextIndex index;
+        TextIndexBuilder builder(index);
+        dfs::traverse_model(model, builder);
+        builder.finish();
+        return index;
+    }
+
+    std::vector<TextMatch> TextIndex::find(std::string_view pattern) const {
+        if (pattern.empty() or pattern.find('\0') != std::string_view::npos) {
+            throw std::invalid_argument("Text pattern must not be empty");
+        }
+        auto [begin, end] = std::equal_range(m_suffixes.begin(), m_suffixes.end(), pattern,
+                                             PrefixLess{m_texts.data(), pattern.size()});
+
+        std::vector<std::uint32_t> texts;
+        for (auto it = begin; it != end; ++it) {
+            auto owner = std::upper_bound(m_text_offsets.begin(), m_text_offsets.end(), *it) - m_text_offsets.begin() - 1;
+            texts.push_back(static_cast<std::uint32_t>(owner));
+        }
+        std::sort(texts.begin(), texts.end());
+        texts.erase(std::unique(texts.begin(), texts.end()), texts.end());
+
+        std::vector<std::uint32_t> documents;
+        for (auto text: texts) {
+            documents.insert(documents.end(), m_postings.begin() + m_posting_offsets[text],
+                             m_postings.begin() + m_posting_offsets[text + 1]);
+        }
+        std::sort(documents.begin(), documents.end());
+
+        std::vector<TextMatch> result;
+        result.reserve(documents.size());
+        for (auto document: documents) {
+            result.push_back({path(m_documents[document].node), text(m_documents[document].text)});
+        }
+        return result;
+    }
+
+    std::size_t TextIndex::bytes() const noexcept {
+        return m_nodes.capacity() * sizeof(Node) + m_documents.capacity() * sizeof(Document) + m_texts.capacity()
+               + (m_text_offsets.capacity() + m_postings.capacity() + m_posting_offsets.capacity()
+                  + m_suffixes.capacity()) * sizeof(std::uint32_t);
+    }
+
+    std::string TextIndex::path(std::uint32_t node) const {
+        std::vector<utilities::Symbol> segments;
+        for (; node != NO_PARENT; node = m_nodes[node].parent) {
+            segments.push_back(m_nodes[node].segment);
+        }
+        std::string result;
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            result.append("/").append(it->view());
+        }
+        return result;
+    }
+
+    std::string_view TextIndex::text(std::uint32_t text) const {
+        return m_texts.data() + m_text_offsets[text];
+    }
+
+}
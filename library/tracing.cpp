@@ -0,0 +1,126 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/tracing.hpp>
+
+#include <algorithm>
+#include <iomanip>
+
+namespace arxml::utilities::tracing {
+
+    namespace {
+        thread_local TraceBuffer* t_buffer = nullptr;
+
+        void writeEscaped(std::ostream& os, std::string_view value) {
+            for (auto character: value) {
+                switch (character) {
+                    case '"': os << "\\\""; break;
+                    case '\\': os << "\\\\"; break;
+                    case '\n': os << "\\n"; break;
+                    case '\t': os << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20) {
+                            os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                               << static_cast<int>(character) << std::dec << std::setfill(' ');
+                        }
+                        else {
+                            os << character;
+                        }
+                }
+            }
+        }
+    }
+
+    TraceRecorder& TraceRecorder::instance() {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    TraceRecorder::TraceRecorder()
+    : m_enabled{false}
+    , m_epoch{std::chrono::steady_clock::now()}
+    {
+
+    }
+
+    std::int64_t TraceRecorder::now() const noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+    }
+
+    void TraceRecorder::attachThread() {
+        if (not t_buffer) {
+            std::lock_guard lock(m_mutex);
+            auto thread_id = static_cast<int>(m_buffers.size()) + 1;
+            t_buffer = m_buffers.emplace_back(std::make_unique<TraceBuffer>(thread_id)).get();
+        }
+    }
+
+    void TraceRecorder::record(const char* name, std::string_view detail, std::int64_t begin,
+                               std::int64_t end) noexcept {
+        if (not t_buffer) {
+            return;
+        }
+        TraceEvent event{name, begin, end - begin, {}};
+        auto length = std::min(detail.size(), TraceEvent::DETAIL_SIZE - 1);
+        std::copy_n(detail.begin(), length, event.detail.begin());
+        event.detail[length] = '\0';
+        t_buffer->push(event);
+    }
+
+    void TraceRecorder::write(std::ostream& os) const {
+        std::lock_guard lock(m_mutex);
+        auto flags = os.flags();
+        os << std::fixed << std::setprecision(3);
+        os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"arxml_tool\"}}";
+        for (const auto& buffer: m_buffers) {
+            os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->getThreadId()
+               << ",\"args\":{\"name\":\"thread " << buffer->getThreadId() << "\"}}";
+            auto written = buffer->getWritten();
+            auto first = written > TraceBuffer::CAPACITY ? written - TraceBuffer::CAPACITY : 0;
+            for (auto index = first; index < written; ++index) {
+                const auto& event = buffer->at(index);
+                os << ",\n{\"name\":\"";
+                writeEscaped(os, event.name);
+                os << "\",\"cat\":\"arxml\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->getThreadId()
+                   << ",\"ts\":" << static_cast<double>(event.begin) / 1e3
+                   << ",\"dur\":" << static_cast<double>(event.duration) / 1e3;
+                if (event.detail[0] != '\0') {
+                    os << ",\"args\":{\"detail\":\"";
+                    writeEscaped(os, event.detail.data());
+                    os << "\"}";
+                }
+                os << "}";
+            }
+            if (first > 0) {
+                os << ",\n{\"name\":\"dropped events\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":"
+                   << buffer->getThreadId() << ",\"ts\":0,\"args\":{\"count\":" << first << "}}";
+            }
+        }
+        os << "\n]}\n";
+        os.flags(flags);
+    }
+
+    TraceScope::TraceScope(const char* name, std::string_view detail)
+    : m_name{name}
+    , m_detail_size{0}
+    , m_begin{0}
+    , m_active{TraceRecorder::instance().isEnabled()}
+    {
+        if (m_active) {
+            TraceRecorder::instance().attachThread();
+            m_detail_size = std::min(detail.size(), m_detail.size() - 1);
+            std::copy_n(detail.begin(), m_detail_size, m_detail.begin());
+            m_begin = TraceRecorder::instance().now();
+        }
+    }
+
+    TraceScope::~TraceScope() {
+        if (m_active) {
+            auto& recorder = TraceRecorder::instance();
+            recorder.record(m_name, {m_detail.data(), m_detail_size}, m_begin, recorder.now());
+        }
+    }
+
+}
@@ -4,7 +4,11 @@
 
 #include "arxml/dfs/traversal.hpp"
 
+#include "arxml/utilities/instrumentation.hpp"
+#include "arxml/utilities/tracing.hpp"
+
 namespace arxml::dfs {
+    // Every traverse_model returns false when the callback stopped the traversal
     class ElementTraversalStrategy {
     public:
         explicit ElementTraversalStrategy(TraversalCallback& callback)
@@ -13,108 +17,157 @@ namespace arxml::dfs {
 
         }
 
-        void traverse_model(model::IAutosarModel& root);
-        void traverse_model(model::IModelEntry& model);
-        void traverse_model(model::IAutosarPackages& packages);
-        void traverse_model(model::IAutosarPackage& packages);
-        void traverse_model(model::IAutosarElements& elements);
-        void traverse_model(model::IAutosarElement& element);
+        bool traverse_model(const model::IAutosarModel& root);
+        bool traverse_model(const model::IModelEntry& model);
+        bool traverse_model(const model::IAutosarPackages& packages);
+        bool traverse_model(const model::IAutosarPackage& packages);
+        bool traverse_model(const model::IAutosarElements& elements);
+        bool traverse_model(const model::IAutosarElement& element);
     private:
         TraversalCallback& m_callback;
     };
 
-    void ElementTraversalStrategy::traverse_model(model::IAutosarModel& root) {
-        m_callback.visit(root);
-        for (auto& [unit_name, unit]: root.getModelUnits()) {
-            traverse_model(*unit);
+    bool ElementTraversalStrategy::traverse_model(const model::IAutosarModel& root) {
+        auto result = m_callback.visit(root);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
+        if (result == VisitResult::CONTINUE) {
+            for (const auto& unit: root.getModelUnits()) {
+                if (not traverse_model(unit)) {
+                    return false;
+                }
+            }
         }
         m_callback.close(root);
-
+        return true;
     }
 
-    void ElementTraversalStrategy::traverse_model(model::IModelEntry& model) {
-        m_callback.visit(model);
-        for (auto& packages: model.getPackages()) {
-            traverse_model(*packages);
+    bool ElementTraversalStrategy::traverse_model(const model::IModelEntry& model) {
+        auto result = m_callback.visit(model);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
+        if (result == VisitResult::CONTINUE) {
+            for (auto& packages: model.getPackages()) {
+                if (not traverse_model(packages)) {
+                    return false;
+                }
+            }
         }
         m_callback.close(model);
+        return true;
     }
 
-    void ElementTraversalStrategy::traverse_model(model::IAutosarPackages& packages) {
-        m_callback.visit(packages);
-        for (auto& subpackages: packages.getPackages()) {
-            traverse_model(*subpackages);
+    bool ElementTraversalStrategy::traverse_model(const model::IAutosarPackages& packages) {
+        auto result = m_callback.visit(packages);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
+        if (result == VisitResult::CONTINUE) {
+            for (auto& subpackages: packages.getPackages()) {
+                if (not traverse_model(subpackages)) {
+                    return false;
+                }
+            }
         }
         m_callback.close(packages);
+        return true;
     }
 
-    void ElementTraversalStrategy::traverse_model(model::IAutosarPackage& package) {
-        m_callback.visit(package);
-        switch(package.getCollectionType()) {
-            case arxml::model::CollectionType::ELEMENTS_COLLECTION: {
-                traverse_model(package.getElements());
-                break;
+    bool ElementTraversalStrategy::traverse_model(const model::IAutosarPackage& package) {
+        auto result = m_callback.visit(package);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
+        if (result == VisitResult::CONTINUE) {
+            bool completed = true;
+            switch(package.getCollectionType()) {
+                case arxml::model::CollectionType::ELEMENTS_COLLECTION: {
+                    completed = traverse_model(package.getElements());
+                    break;
+                }
+                case arxml::model::CollectionType::PACKAGES_COLLECTION: {
+                    completed = traverse_model(package.getPackages());
+                    break;
+                }
+                default:
+                    //invalid branch
+                    break;
             }
-            case arxml::model::CollectionType::PACKAGES_COLLECTION: {
-                traverse_model(package.getPackages());
-                break;
+            if (not completed) {
+                return false;
             }
-            default:
-                //invalid branch
-                break;
         }
         m_callback.close(package);
+        return true;
     }
 
-    void ElementTraversalStrategy::traverse_model(model::IAutosarElements& elements) {
-        m_callback.visit(elements);
-        for (auto& it: elements.getElements()) {
-            traverse_model(*it);
+    bool ElementTraversalStrategy::traverse_model(const model::IAutosarElements& elements) {
+        auto result = m_callback.visit(elements);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
+        if (result == VisitResult::CONTINUE) {
+            for (auto& it: elements.getElements()) {
+                if (not traverse_model(it)) {
+                    return false;
+                }
+            }
         }
         m_callback.close(elements);
+        return true;
     }
 
-    void ElementTraversalStrategy::traverse_model(model::IAutosarElement& element) {
-        m_callback.visit(element);
+    bool ElementTraversalStrategy::traverse_model(const model::IAutosarElement& element) {
+        auto result = m_callback.visit(element);
+        if (result == VisitResult::STOP) {
+            return false;
+        }
         bool is_named_element = element.getType() == model::EntryType::NAMED_ELEMENT;
         bool is_composite_element = element.getType() == model::EntryType::COMPOSITE_ELEMENT;
-        if (is_composite_element or is_named_element) {
-            auto& composite = dynamic_cast<model::ICompositeAutosarElement&>(element);
+        if (result == VisitResult::CONTINUE and (is_composite_element or is_named_element)) {
+            auto& composite = dynamic_cast<const model::ICompositeAutosarElement&>(element);
             for (auto& subelements:  composite.getSubElements()) {
-                traverse_model(*subelements);
+                if (not traverse_model(subelements)) {
+                    return false;
+                }
             }
         }
         m_callback.close(element);
+        return true;
     }
 
 
     template<class ModelElement>
-    void traverse_model_tree(ModelElement& element, TraversalCallback& callback) {
+    void traverse_model_tree(const ModelElement& element, TraversalCallback& callback) {
+        ARXML_PROFILE_SCOPE(utilities::instrumentation::Phase::TRAVERSAL);
+        ARXML_TRACE_SCOPE("traverse");
         ElementTraversalStrategy traversal_strategy{callback};
         traversal_strategy.traverse_model(element);
     }
 
-    void traverse_model(model::IAutosarModel& root, TraversalCallback& callback) {
+    void traverse_model(const model::IAutosarModel& root, TraversalCallback& callback) {
         traverse_model_tree(root, callback);
     }
 
-    void traverse_model(model::IModelEntry& model_unit, TraversalCallback& callback) {
+    void traverse_model(const model::IModelEntry& model_unit, TraversalCallback& callback) {
         traverse_model_tree(model_unit, callback);
     }
 
-    void traverse_model(model::IAutosarPackages& packages, TraversalCallback& callback) {
+    void traverse_model(const model::IAutosarPackages& packages, TraversalCallback& callback) {
         traverse_model_tree(packages, callback);
     }
 
-    void traverse_model(model::IAutosarPackage& package, TraversalCallback& callback) {
+    void traverse_model(const model::IAutosarPackage& package, TraversalCallback& callback) {
         traverse_model_tree(package, callback);
     }
 
-    void traverse_model(model::IAutosarElements& elements, TraversalCallback& callback) {
+    void traverse_model(const model::IAutosarElements& elements, TraversalCallback& callback) {
         traverse_model_tree(elements, callback);
     }
 
-    void traverse_model(model::IAutosarElement& element, TraversalCallback& callback) {
+    void traverse_model(const model::IAutosarElement& element, TraversalCallback& callback) {
         traverse_model_tree(element, callback);
     }
 }
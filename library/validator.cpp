@@ -0,0 +1,530 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/utilities/validator.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+
+#include <arxml/helpers/content_hash.hpp>
+#include <arxml/utilities/input_source.hpp>
+
+namespace arxml::utilities {
+
+    namespace {
+        class ScanError : public std::runtime_error {
+        public:
+            using std::runtime_error::runtime_error;
+        };
+
+        bool isSpace(int character) {
+            return character == ' ' or character == '\t' or character == '\n' or character == '\r';
+        }
+
+        void appendUtf8(std::string& output, unsigned long code) {
+            if (code < 0x80) {
+                output.push_back(static_cast<char>(code));
+            }
+            else if (code < 0x800) {
+                output.push_back(static_cast<char>(0xc0 | (code >> 6)));
+                output.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+            }
+            else if (code < 0x10000) {
+                output.push_back(static_cast<char>(0xe0 | (code >> 12)));
+                output.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3f)));
+                output.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+            }
+            else {
+                output.push_back(static_cast<char>(0xf0 | (code >> 18)));
+                output.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3f)));
+                output.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3f)));
+                output.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+            }
+        }
+
+        // Pull tokenizer reading the stream character by character, so only the current token is held in memory.
+        // Understands what ARXML files use: elements, attributes, text with entities, CDATA, comments, processing
+        // instructions and a DOCTYPE without internal subset.
+        class XmlTokenizer {
+        public:
+            enum class Token {
+                START,      // name(), isEmpty() for <tag/>, destination() when there is a DEST attribute
+                END,        // name()
+                TEXT,       // text(), not reported when it is whitespace only
+                END_OF_INPUT
+            };
+
+            explicit XmlTokenizer(std::istream& input)
+            : m_buffer{*input.rdbuf()}
+            , m_line{1}
+            , m_token_line{1}
+            , m_empty{false}
+            {
+
+            }
+
+            Token next() {
+                while (true) {
+                    m_token_line = m_line;
+                    auto character = peek();
+                    if (character == END) {
+                        return Token::END_OF_INPUT;
+                    }
+                    if (character != '<') {
+                        if (readText()) {
+                            return Token::TEXT;
+                        }
+                        continue;
+                    }
+                    get();
+                    character = peek();
+                    if (character == '?') {
+                        skipPast("?>");
+                    }
+                    else if (character == '!') {
+                        get();
+                        if (readDeclaration()) {
+                            return Token::TEXT;
+                        }
+                    }
+                    else if (character == '/') {
+                        get();
+                        readName();
+                        skipSpaces();
+                        expect('>');
+                        return Token::END;
+                    }
+                    else {
+                        readStartTag();
+                        return Token::START;
+                    }
+                }
+            }
+
+            [[nodiscard]] const std::string& name() const noexcept { return m_name; }
+            [[nodiscard]] const std::string& text() const noexcept { return m_text; }
+            [[nodiscard]] bool isEmpty() const noexcept { return m_empty; }
+            [[nodiscard]] const std::optional<std::string>& destination() const noexcept { return m_destination; }
+            // Line on which the last token started
+            [[nodiscard]] int line() const noexcept { return m_token_line; }
+        private:
+            static constexpr int END = std::char_traits<char>::eof();
+
+            int peek() { return m_buffer.sgetc(); }
+
+            int get() {
+                auto character = m_buffer.sbumpc();
+                if (character == '\n') {
+                    ++m_line;
+                }
+                return character;
+            }
+
+            int getChecked() {
+                auto character = get();
+                if (character == END) {
+                    throw ScanError("unexpected end of file");
+                }
+                return character;
+            }
+
+            void expect(char expected) {
+                if (getChecked() != expected) {
+                    throw ScanError(std::string("expected '") + expected + "'");
+                }
+            }
+
+            void skipSpaces() {
+                while (isSpace(peek())) {
+                    get();
+                }
+            }
+
+            void skipPast(std::string_view terminator) {
+                std::string window;
+                while (window != terminator) {
+                    if (window.size() == terminator.size()) {
+                        window.erase(0, 1);
+                    }
+                    window.push_back(static_cast<char>(getChecked()));
+                }
+            }
+
+            void readName() {
+                m_name.clear();
+                while (true) {
+                    auto character = peek();
+                    if (character == END or isSpace(character) or character == '>' or character == '/'
+                        or character == '=') {
+                        break;
+                    }
+                    m_name.push_back(static_cast<char>(get()));
+                }
+                if (m_name.empty()) {
+                    throw ScanError("missing name");
+                }
+            }
+
+            void readStartTag() {
+                readName();
+                m_empty = false;
+                m_destination.reset();
+                std::string attribute;
+                while (true) {
+                    skipSpaces();
+                    auto character = getChecked();
+                    if (character == '>') {
+                        return;
+                    }
+                    if (character == '/') {
+                        expect('>');
+                        m_empty = true;
+                        return;
+                    }
+                    attribute.assign(1, static_cast<char>(character));
+                    while (peek() != END and not isSpace(peek()) and peek() != '=') {
+                        attribute.push_back(static_cast<char>(get()));
+                    }
+                    skipSpaces();
+                    expect('=');
+                    skipSpaces();
+                    auto quote = getChecked();
+                    if (quote != '"' and quote != '\'') {
+                        throw ScanError("unquoted value of attribute " + attribute);
+                    }
+                    m_text.clear();
+                    while ((character = getChecked()) != quote) {
+                        append(character);
+                    }
+                    if (attribute == "DEST") {
+                        m_destination = m_text;
+                    }
+                }
+            }
+
+            // Text up to the next tag; false when it is whitespace only
+            bool readText() {
+                m_text.clear();
+                bool blank = true;
+                while (peek() != END and peek() != '<') {
+                    auto character = get();
+                    blank = blank and isSpace(character);
+                    append(character);
+                }
+                return not blank;
+            }
+
+            // After "<!"; true for CDATA, whose content becomes the text
+            bool readDeclaration() {
+                if (peek() == '-') {
+                    get();
+                    expect('-');
+                    skipPast("-->");
+                    return false;
+                }
+                if (peek() == '[') {
+                    for (auto expected: std::string_view("[CDATA[")) {
+                        expect(expected);
+                    }
+                    m_text.clear();
+                    while (not m_text.ends_with("]]>")) {
+                        m_text.push_back(static_cast<char>(getChecked()));
+                    }
+                    m_text.resize(m_text.size() - 3);
+                    return true;
+                }
+                skipPast(">");
+                return false;
+            }
+
+            void append(int character) {
+                if (character != '&') {
+                    m_text.push_back(static_cast<char>(character));
+                    return;
+                }
+                std::string entity;
+                while ((character = getChecked()) != ';') {
+                    if (entity.size() > 8) {
+                        throw ScanError("unterminated entity");
+                    }
+                    entity.push_back(static_cast<char>(character));
+                }
+                if (entity == "lt") { m_text.push_back('<'); }
+                else if (entity == "gt") { m_text.push_back('>'); }
+                else if (entity == "amp") { m_text.push_back('&'); }
+                else if (entity == "quot") { m_text.push_back('"'); }
+                else if (entity == "apos") { m_text.push_back('\''); }
+                else if (entity.size() > 1 and entity[0] == '#') {
+                    try {
+                        auto hex = entity[1] == 'x';
+                        appendUtf8(m_text, std::stoul(entity.substr(hex ? 2 : 1), nullptr, hex ? 16 : 10));
+                    }
+                    catch (const std::logic_error&) {
+                        throw ScanError("invalid character reference &" + entity + ";");
+                    }
+                }
+                else {
+                    throw ScanError("unknown entity &" + entity + ";");
+                }
+            }
+
+            std::streambuf& m_buffer;
+            int m_line;
+            int m_token_line;
+            std::string m_name;
+            std::string m_text;
+            bool m_empty;
+            std::optional<std::string> m_destination;
+        };
+    }
+
+    // State of a single file: the open elements and the path of the innermost named one
+    class FileScanner {
+    public:
+        FileScanner(StructureValidator& validator, const std::string& file)
+        : m_validator{validator}
+        , m_file{file}
+        , m_packages_count{0}
+        {
+
+        }
+
+        void scan(std::istream& input) {
+            XmlTokenizer tokenizer(input);
+            try {
+                while (true) {
+                    switch (tokenizer.next()) {
+                        case XmlTokenizer::Token::START:
+                            open(tokenizer);
+                            if (tokenizer.isEmpty()) {
+                                close(tokenizer.name(), tokenizer.line());
+                            }
+                            break;
+                        case XmlTokenizer::Token::END:
+                            close(tokenizer.name(), tokenizer.line());
+                            break;
+                        case XmlTokenizer::Token::TEXT:
+                            text(tokenizer.text(), tokenizer.line());
+                            break;
+                        case XmlTokenizer::Token::END_OF_INPUT:
+                            finish(tokenizer.line());
+                            return;
+                    }
+                }
+            }
+            catch (const ScanError& error) {
+                report(Severity::ERROR, tokenizer.line(), std::string("malformed XML: ") + error.what()
+                                                          + ", rest of file skipped");
+            }
+        }
+    private:
+        struct Frame {
+            std::string tag;
+            int line;
+            std::size_t path_size;  // length of the path before the short name of this element
+            bool needs_name;
+            bool named;
+            std::optional<std::string> destination;
+            std::string text;
+        };
+
+        void open(const XmlTokenizer& tokenizer) {
+            const auto& tag = tokenizer.name();
+            if (m_frames.empty()) {
+                if (m_root_seen) {
+                    throw ScanError("second root element " + tag);
+                }
+                m_root_seen = true;
+                if (tag != "AUTOSAR") {
+                    report(Severity::ERROR, tokenizer.line(), "root element " + tag + " instead of AUTOSAR");
+                }
+            }
+            else if (m_frames.size() == 1 and tag == "AR-PACKAGES" and ++m_packages_count > 1) {
+                report(Severity::ERROR, tokenizer.line(), "more than one AR-PACKAGES");
+            }
+            auto needs_name = tag == "AR-PACKAGE" or (not m_frames.empty() and m_frames.back().tag == "ELEMENTS");
+            m_frames.push_back({tag, tokenizer.line(), m_path.size(), needs_name, false, tokenizer.destination(), {}});
+        }
+
+        void text(const std::string& text, int line) {
+            if (m_frames.empty()) {
+                throw ScanError("text outside of the root element");
+            }
+            auto& frame = m_frames.back();
+            if (frame.destination) {
+                frame.text += text;
+            }
+            if (frame.tag != "SHORT-NAME" or m_frames.size() < 2) {
+                return;
+            }
+            auto& owner = m_frames[m_frames.size() - 2];
+            if (owner.named) {
+                report(Severity::WARNING, line, "repeated SHORT-NAME ignored");
+                return;
+            }
+            owner.named = true;
+            m_path.append("/").append(text);
+            m_validator.definePath(m_path, {&m_file, owner.line, owner.tag == "AR-PACKAGE"});
+        }
+
+        void close(const std::string& tag, int line) {
+            if (m_frames.empty() or m_frames.back().tag != tag) {
+                throw ScanError("unexpected </" + tag + ">"
+                                + (m_frames.empty() ? std::string() : ", expected </" + m_frames.back().tag + ">"));
+            }
+            auto& frame = m_frames.back();
+            if (frame.destination) {
+                m_validator.checkReference(std::move(frame.text), std::move(*frame.destination), {&m_file, frame.line, false});
+            }
+            if (frame.needs_name and not frame.named) {
+                report(Severity::ERROR, frame.line, tag + " without SHORT-NAME");
+            }
+            if (frame.named) {
+                m_path.resize(frame.path_size);
+            }
+            if (m_frames.size() == 1 and m_packages_count == 0) {
+                report(Severity::ERROR, frame.line, tag + " without AR-PACKAGES");
+            }
+            m_frames.pop_back();
+        }
+
+        void finish(int line) {
+            if (not m_frames.empty()) {
+                throw ScanError("unexpected end of file, <" + m_frames.back().tag + "> not closed");
+            }
+            if (not m_root_seen) {
+                report(Severity::ERROR, line, "no root element");
+            }
+        }
+
+        void report(Severity severity, int line, std::string message) {
+            m_validator.m_diagnostics.report({severity, m_file, line, std::move(message)});
+        }
+
+        StructureValidator& m_validator;
+        const std::string& m_file;
+        std::vector<Frame> m_frames;
+        std::string m_path;
+        std::size_t m_packages_count;
+        bool m_root_seen = false;
+    };
+
+    void StructureValidator::validateFile(const std::string& filename) {
+        auto compression = io::model_file_compression(filename).value_or(io::Compression::NONE);
+        if (compression == io::Compression::NONE) {
+            std::ifstream input(filename, std::ios::binary);
+            if (not input.is_open()) {
+                m_diagnostics.report({Severity::ERROR, filename, 0, "cannot open file"});
+                return;
+            }
+            validate(filename, input);
+            return;
+        }
+        // Decompressors produce the whole content at once
+        std::istringstream input;
+        try {
+            input.str(io::open_file_source(filename)->getContent());
+        }
+        catch (const std::exception& error) {
+            m_diagnostics.report({Severity::ERROR, filename, 0, std::string(error.what()) + ", file skipped"});
+            return;
+        }
+        validate(filename, input);
+    }
+
+    void StructureValidator::validate(const std::string& unit_name, std::istream& input) {
+        FileScanner scanner(*this, *addFile(unit_name));
+        scanner.scan(input);
+        ++m_files;
+    }
+
+    void StructureValidator::finish() {
+        std::vector<Reference> duplicates;
+        std::vector<Reference> unresolved;
+        {
+            std::lock_guard lock(m_mutex);
+            duplicates.swap(m_duplicates);
+            unresolved.swap(m_unresolved);
+        }
+        for (auto& duplicate: duplicates) {
+            auto first = shardOf(duplicate.target).paths.at(duplicate.target);
+            m_diagnostics.report({Severity::ERROR, *duplicate.location.file, duplicate.location.line,
+                                  "duplicate path " + duplicate.text + ", first defined at " + *first.file + ":"
+                                  + std::to_string(first.line)});
+        }
+        for (auto& reference: unresolved) {
+            if (not isDefined(reference.target)) {
+                m_diagnostics.report({Severity::ERROR, *reference.location.file, reference.location.line,
+                                      "dangling reference to " + reference.text + " (" + reference.destination + ")"});
+            }
+        }
+    }
+
+    std::size_t StructureValidator::paths() const {
+        std::size_t result = 0;
+        for (const auto& shard: m_shards) {
+            std::lock_guard lock(shard.mutex);
+            result += shard.paths.size();
+        }
+        return result;
+    }
+
+    const std::string* StructureValidator::addFile(const std::string& unit_name) {
+        std::lock_guard lock(m_mutex);
+        return &m_file_names.emplace_back(unit_name);
+    }
+
+    // Of two definitions of the same path the one earlier in file and line order is kept and the other one
+    // reported when validation finishes, so the result does not depend on the order in which files were scanned
+    void StructureValidator::definePath(const std::string& path, Location location) {
+        auto hash = helpers::hash_string(path);
+        auto& shard = shardOf(hash);
+        std::unique_lock lock(shard.mutex);
+        auto [it, inserted] = shard.paths.try_emplace(hash, location);
+        if (inserted) {
+            return;
+        }
+        auto first = it->second;
+        auto conflict = not (first.package and location.package);
+        if (std::tie(*location.file, location.line) < std::tie(*first.file, first.line)) {
+            std::swap(first, location);
+            it->second = first;
+        }
+        lock.unlock();
+        if (conflict) {
+            std::lock_guard duplicates_lock(m_mutex);
+            m_duplicates.push_back({hash, location, path, {}});
+        }
+    }
+
+    // Relative references need the base of their package and are not checked
+    void StructureValidator::checkReference(std::string text, std::string destination, Location location) {
+        if (text.empty()) {
+            m_diagnostics.report({Severity::ERROR, *location.file, location.line,
+                                  "empty reference (" + destination + ")"});
+            return;
+        }
+        if (text.front() != '/') {
+            return;
+        }
+        auto hash = helpers::hash_string(text);
+        if (isDefined(hash)) {
+            return;
+        }
+        std::lock_guard lock(m_mutex);
+        m_unresolved.push_back({hash, location, std::move(text), std::move(destination)});
+    }
+
+    bool StructureValidator::isDefined(std::uint64_t path) const {
+        const auto& shard = shardOf(path);
+        std::lock_guard lock(shard.mutex);
+        return shard.paths.contains(path);
+    }
+
+}
@@ -0,0 +1,30 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#include <arxml/helpers/values.hpp>
+
+#include <array>
+#include <charconv>
+
+namespace arxml::helpers {
+
+    std::string simple_value(const model::ISimpleAutosarElement& element) {
+        switch (element.getType()) {
+            case model::EntryType::INTEGER_ELEMENT:
+                return std::to_string(dynamic_cast<const model::INumberAutosarElement&>(element).getInteger());
+            case model::EntryType::FLOATING_ELEMENT: {
+                std::array<char, 32> buffer{};
+                auto value = dynamic_cast<const model::INumberAutosarElement&>(element).getFloating();
+                auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+                return {buffer.data(), end};
+            }
+            case model::EntryType::STRING_ELEMENT:
+            case model::EntryType::REFERENCE_ELEMENT:
+                return dynamic_cast<const model::IStringAutosarElement&>(element).getText();
+            default:
+                return {}; // INVALID BRANCH
+        }
+    }
+
+}
@@ -0,0 +1,203 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include <arxml/helpers/columnar.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+              <TYPE-TREF DEST="DATA-TYPE">/apd/Type</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    // Reads flatbuffer metadata as the format defines it, independently of the writer in the library
+    class FlatBuffer {
+    public:
+        explicit FlatBuffer(std::string_view bytes) : m_bytes{bytes} {}
+
+        template<class T>
+        [[nodiscard]] T read(std::size_t position) const {
+            T value;
+            std::memcpy(&value, m_bytes.data() + position, sizeof(T));
+            return value;
+        }
+
+        [[nodiscard]] std::size_t root() const { return read<std::uint32_t>(0); }
+        [[nodiscard]] std::size_t vtable(std::size_t table) const { return table - read<std::int32_t>(table); }
+        [[nodiscard]] std::size_t fieldCount(std::size_t table) const {
+            return (read<std::uint16_t>(vtable(table)) - 2 * sizeof(std::uint16_t)) / sizeof(std::uint16_t);
+        }
+
+        // Position of the field, 0 when absent
+        [[nodiscard]] std::size_t field(std::size_t table, std::size_t id) const {
+            if (id >= fieldCount(table)) {
+                return 0;
+            }
+            auto offset = read<std::uint16_t>(vtable(table) + sizeof(std::uint16_t) * (2 + id));
+            EXPECT_LT(offset, read<std::uint16_t>(vtable(table) + sizeof(std::uint16_t)));
+            return offset == 0 ? 0 : table + offset;
+        }
+
+        template<class T>
+        [[nodiscard]] T scalar(std::size_t table, std::size_t id) const {
+            auto position = field(table, id);
+            EXPECT_EQ(0, position % sizeof(T));
+            return position == 0 ? T{} : read<T>(position);
+        }
+
+        [[nodiscard]] std::size_t object(std::size_t table, std::size_t id) const {
+            auto position = field(table, id);
+            return position + read<std::uint32_t>(position);
+        }
+
+        [[nodiscard]] std::string_view string(std::size_t table, std::size_t id) const {
+            auto position = object(table, id);
+            return m_bytes.substr(position + sizeof(std::uint32_t), read<std::uint32_t>(position));
+        }
+
+        // Vector length and position of its first element
+        [[nodiscard]] std::pair<std::size_t, std::size_t> vector(std::size_t table, std::size_t id) const {
+            auto position = object(table, id);
+            return {read<std::uint32_t>(position), position + sizeof(std::uint32_t)};
+        }
+    private:
+        std::string_view m_bytes;
+    };
+
+    // Message: continuation marker, metadata length, metadata, body
+    struct Message {
+        std::string_view metadata;
+        std::string_view body;
+    };
+
+    std::vector<Message> messages(std::string_view stream) {
+        std::vector<Message> result;
+        while (stream.size() >= 8) {
+            std::int32_t length;
+            std::memcpy(&length, stream.data() + 4, sizeof(length));
+            if (length == 0) {
+                break;
+            }
+            FlatBuffer metadata(stream.substr(8, length));
+            auto body = static_cast<std::size_t>(metadata.scalar<std::int64_t>(metadata.root(), 3));
+            result.push_back({stream.substr(8, length), stream.substr(8 + length, body)});
+            stream.remove_prefix(8 + length + body);
+        }
+        return result;
+    }
+}
+
+TEST(ColumnarTest, TabulatesElementsAndReferencesAsCsv) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto tables = arxml::helpers::tabulate_model(*model);
+    std::ostringstream elements;
+    arxml::helpers::write_csv(elements, tables.elements);
+    EXPECT_EQ("path,tag,parent,file\n"
+              "/apd/Service,SERVICE-INTERFACE,/apd,model.arxml\n"
+              "/apd/Service/Speed,VARIABLE-DATA-PROTOTYPE,/apd/Service,model.arxml\n"
+              "/apd/Type,DATA-TYPE,/apd,model.arxml\n", elements.str());
+    std::ostringstream references;
+    arxml::helpers::write_csv(references, tables.references);
+    EXPECT_EQ("source,dest,target\n/apd/Service/Speed,DATA-TYPE,/apd/Type\n", references.str());
+
+    arxml::helpers::Table quoted{"value"};
+    quoted.addRow({"a,\"b\""});
+    std::ostringstream csv;
+    arxml::helpers::write_csv(csv, quoted);
+    EXPECT_EQ("value\n\"a,\"\"b\"\"\"\n", csv.str());
+}
+
+TEST(ColumnarTest, ArrowStreamIsFramedAndAligned) {
+    arxml::helpers::Table table{"name", "kind"};
+    table.addRow({"first", "a"});
+    table.addRow({"second", "bc"});
+    std::ostringstream stream;
+    arxml::helpers::write_arrow_ipc(stream, table);
+    auto bytes = stream.str();
+    ASSERT_GT(bytes.size(), 16);
+    EXPECT_EQ(0, bytes.size() % 8);
+    EXPECT_EQ(std::string("\xff\xff\xff\xff", 4), bytes.substr(0, 4));
+    EXPECT_EQ(std::string("\xff\xff\xff\xff\0\0\0\0", 8), bytes.substr(bytes.size() - 8));
+
+    auto framed = messages(bytes);
+    ASSERT_EQ(2, framed.size());
+    for (const auto& message: framed) {
+        EXPECT_EQ(0, message.metadata.size() % 8);
+        FlatBuffer metadata(message.metadata);
+        // Message: version, header type, header, body length
+        EXPECT_EQ(4, metadata.fieldCount(metadata.root()));
+        EXPECT_EQ(4, metadata.scalar<std::int16_t>(metadata.root(), 0));
+    }
+
+    FlatBuffer schema(framed[0].metadata);
+    EXPECT_EQ(1, schema.scalar<std::uint8_t>(schema.root(), 1));
+    EXPECT_TRUE(framed[0].body.empty());
+    auto fields = schema.vector(schema.object(schema.root(), 2), 1);
+    ASSERT_EQ(2, fields.first);
+    std::vector<std::string_view> names;
+    for (std::size_t it = 0; it < fields.first; ++it) {
+        auto position = fields.second + it * sizeof(std::uint32_t);
+        auto field = position + schema.read<std::uint32_t>(position);
+        names.push_back(schema.string(field, 0));
+        EXPECT_FALSE(schema.scalar<std::uint8_t>(field, 1));
+        EXPECT_EQ(5, schema.scalar<std::uint8_t>(field, 2));    // Utf8
+        EXPECT_EQ(0, schema.fieldCount(schema.object(field, 3)));
+        EXPECT_EQ(0, schema.vector(field, 5).first);
+    }
+    EXPECT_EQ((std::vector<std::string_view>{"name", "kind"}), names);
+
+    FlatBuffer batch(framed[1].metadata);
+    EXPECT_EQ(3, batch.scalar<std::uint8_t>(batch.root(), 1));
+    EXPECT_EQ(56, framed[1].body.size());
+    auto record_batch = batch.object(batch.root(), 2);
+    EXPECT_EQ(2, batch.scalar<std::int64_t>(record_batch, 0));
+    // Field nodes: length, null count
+    auto nodes = batch.vector(record_batch, 1);
+    ASSERT_EQ(2, nodes.first);
+    EXPECT_EQ(0, nodes.second % 8);
+    for (std::size_t it = 0; it < nodes.first; ++it) {
+        EXPECT_EQ(2, batch.read<std::int64_t>(nodes.second + 16 * it));
+        EXPECT_EQ(0, batch.read<std::int64_t>(nodes.second + 16 * it + 8));
+    }
+    // Buffers: offset, length of the validity bitmap, offsets and data of every column
+    auto buffers = batch.vector(record_batch, 2);
+    ASSERT_EQ(6, buffers.first);
+    EXPECT_EQ(0, buffers.second % 8);
+    std::vector<std::pair<std::int64_t, std::int64_t>> locations;
+    for (std::size_t it = 0; it < buffers.first; ++it) {
+        locations.emplace_back(batch.read<std::int64_t>(buffers.second + 16 * it),
+                               batch.read<std::int64_t>(buffers.second + 16 * it + 8));
+    }
+    EXPECT_EQ((std::vector<std::pair<std::int64_t, std::int64_t>>{{0, 0}, {0, 12}, {16, 11}, {32, 0}, {32, 12},
+                                                                 {48, 3}}), locations);
+    std::int32_t offsets[3];
+    std::memcpy(offsets, framed[1].body.data() + 32, sizeof(offsets));
+    EXPECT_EQ(1, offsets[1]);
+    EXPECT_EQ(3, offsets[2]);
+    EXPECT_EQ("firstsecond", framed[1].body.substr(16, 11));
+    EXPECT_EQ("abc", framed[1].body.substr(48, 3));
+}
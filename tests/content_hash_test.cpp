@@ -0,0 +1,66 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/helpers/content_hash.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL_TEMPLATE = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>First</SHORT-NAME>
+          <MAJOR-VERSION>@VALUE@</MAJOR-VERSION>
+        </SERVICE-INTERFACE>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Second</SHORT-NAME>
+          <TYPE-TREF DEST="DATA-TYPE">/apd/Type</TYPE-TREF>
+        </SERVICE-INTERFACE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::unique_ptr<arxml::model::IAutosarModel> parse(const std::string& version) {
+        std::string content = MODEL_TEMPLATE;
+        content.replace(content.find("@VALUE@"), 7, version);
+        return arxml::test::parseModel(content, true);
+    }
+
+    arxml::model::IAutosarPackage& package(arxml::model::IAutosarModel& model) {
+        return *model.getModelEntry("model.arxml").getPackages()[0];
+    }
+
+    arxml::model::INamedAutosarElement& element(arxml::model::IAutosarModel& model, int index) {
+        return *package(model).getElements().getElements()[index];
+    }
+}
+
+TEST(ContentHashTest, EqualModelsHaveEqualHashes) {
+    auto lhs = parse("1");
+    auto rhs = parse("1");
+    EXPECT_NE(0, package(*lhs).getContentHash());
+    EXPECT_EQ(package(*lhs).getContentHash(), package(*rhs).getContentHash());
+    EXPECT_EQ(element(*lhs, 0).getContentHash(), element(*rhs, 0).getContentHash());
+}
+
+TEST(ContentHashTest, ChangeIsPropagatedOnlyToAncestors) {
+    auto lhs = parse("1");
+    auto rhs = parse("2");
+    EXPECT_NE(package(*lhs).getContentHash(), package(*rhs).getContentHash());
+    EXPECT_NE(element(*lhs, 0).getContentHash(), element(*rhs, 0).getContentHash());
+    EXPECT_EQ(element(*lhs, 1).getContentHash(), element(*rhs, 1).getContentHash());
+}
+
+TEST(ContentHashTest, StoredHashMatchesRecomputedHash) {
+    auto model = parse("1.5");
+    auto stored = element(*model, 0).getContentHash();
+    EXPECT_EQ(stored, arxml::helpers::annotate_content_hashes(element(*model, 0)));
+    EXPECT_EQ(stored, arxml::helpers::content_hash(element(*model, 0)));
+}
@@ -0,0 +1,100 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/helpers/diff.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* BEFORE = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+              <TYPE-TREF DEST="DATA-TYPE">/apd/Float</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Unit</SHORT-NAME>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Float</SHORT-NAME>
+          <SIZE>32</SIZE>
+        </DATA-TYPE>
+        <DATA-TYPE>
+          <SHORT-NAME>Removed</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* AFTER = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+              <TYPE-TREF DEST="IMPLEMENTATION-DATA-TYPE">/apd/Double</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Unit</SHORT-NAME>
+            </VARIABLE-DATA-PROTOTYPE>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Torque</SHORT-NAME>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Float</SHORT-NAME>
+          <SIZE>32</SIZE>
+        </DATA-TYPE>
+        <DATA-TYPE>
+          <SHORT-NAME>Added</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::vector<std::string> compare(bool content_hashing) {
+        auto lhs = arxml::test::parseModel(BEFORE, content_hashing);
+        auto rhs = arxml::test::parseModel(AFTER, content_hashing);
+        std::vector<std::string> result;
+        for (const auto& difference: arxml::helpers::ModelComparator(*lhs, *rhs).compare()) {
+            const char* kinds[] = {"added", "removed", "changed"};
+            result.push_back(std::string(kinds[static_cast<int>(difference.kind)]) + " " + difference.path + " "
+                             + difference.description);
+        }
+        return result;
+    }
+}
+
+TEST(DiffTest, ReportsAddedRemovedAndChangedElements) {
+    // Ordered by path
+    std::vector<std::string> expected{
+        "added /apd/Added DATA-TYPE",
+        "removed /apd/Removed DATA-TYPE",
+        "changed /apd/Service/EVENTS/Speed/TYPE-TREF '/apd/Float' -> '/apd/Double'",
+        "changed /apd/Service/EVENTS/Speed/TYPE-TREF@DEST 'DATA-TYPE' -> 'IMPLEMENTATION-DATA-TYPE'",
+        "added /apd/Service/EVENTS/Torque VARIABLE-DATA-PROTOTYPE"};
+    EXPECT_EQ(expected, compare(true));
+}
+
+TEST(DiffTest, ComparesModelsWithoutContentHashesInFull) {
+    EXPECT_EQ(compare(true), compare(false));
+}
@@ -0,0 +1,30 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/finders.hpp>
+
+#include "test_model.hpp"
+
+TEST(FindersTest, TagFinderCreatedBeforeModelIsLoaded) {
+    std::map<std::string, const arxml::model::INamedAutosarElement&> result;
+    arxml::helpers::ElementByTagFinder finder(result, "FINDERS-TEST-INTERFACE");
+    auto model = arxml::test::parseModel(R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <FINDERS-TEST-INTERFACE><SHORT-NAME>First</SHORT-NAME></FINDERS-TEST-INTERFACE>
+        <FINDERS-TEST-INTERFACE><SHORT-NAME>Second</SHORT-NAME></FINDERS-TEST-INTERFACE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)");
+    arxml::dfs::traverse_model(*model, finder);
+    ASSERT_EQ(2, result.size());
+    EXPECT_TRUE(result.contains("/apd/First"));
+    EXPECT_TRUE(result.contains("/apd/Second"));
+}
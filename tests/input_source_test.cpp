@@ -0,0 +1,80 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <arxml/utilities/input_source.hpp>
+
+namespace {
+    // Two gzip members, "<AUTOSAR>first " and "second</AUTOSAR>"
+    const std::string CONCATENATED_GZIP(
+        "\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\xb3\x71\x0c\x0d\xf1\x0f\x76\x0c\xb2\x4b\xcb\x2c\x2a\x2e\x51\x00"
+        "\x00\x89\xce\xf9\x35\x0f\x00\x00\x00\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x2b\x4e\x4d\xce\xcf\x4b\xb1"
+        "\xd1\x77\x0c\x0d\xf1\x0f\x76\x0c\xb2\x03\x00\xfb\x83\x10\x84\x10\x00\x00\x00", 71);
+
+    // Single zstd frame with its content size, "<AUTOSAR>" followed by 16 times "<AR-PACKAGES/>" and "</AUTOSAR>"
+    const std::string ZSTD_FRAME(
+        "\x28\xb5\x2f\xfd\x20\xf3\x25\x01\x00\xf2\xc1\x06\x0b\xb0\x3d\x8c\x48\x4c\xc6\xd1\xba\x24\xea"
+        "\x02\xa3\x5f\xe4\x7e\xc4\x96\xfd\xe8\x09\x7a\x19\xfd\x22\xf7\x25\x01\x00\xa2\x41\xcd\x26", 45);
+
+    std::string writeFile(const std::string& name, const std::string& content) {
+        auto path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    }
+}
+
+TEST(InputSourceTest, ReadsFileContentVerbatim) {
+    auto path = writeFile("input_source_test.arxml", "<AUTOSAR>\n  <AR-PACKAGES/>\n</AUTOSAR>");
+    auto source = arxml::utilities::io::open_file_source(path);
+    EXPECT_EQ("<AUTOSAR>\n  <AR-PACKAGES/>\n</AUTOSAR>", source->getContent());
+    std::filesystem::remove(path);
+}
+
+TEST(InputSourceTest, DecompressesConcatenatedGzipMembers) {
+    using arxml::utilities::io::Compression;
+    if (not arxml::utilities::io::is_compression_available(Compression::GZIP)) {
+        GTEST_SKIP() << "built without zlib";
+    }
+    auto path = writeFile("input_source_test.arxml.gz", CONCATENATED_GZIP);
+    auto source = arxml::utilities::io::open_file_source(path);
+    EXPECT_EQ("<AUTOSAR>first second</AUTOSAR>", source->getContent());
+
+    std::filesystem::resize_file(path, CONCATENATED_GZIP.size() - 10);
+    auto truncated = arxml::utilities::io::open_file_source(path);
+    EXPECT_THROW(truncated->getContent(), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(InputSourceTest, DecompressesZstdFrame) {
+    using arxml::utilities::io::Compression;
+    if (not arxml::utilities::io::is_compression_available(Compression::ZSTD)) {
+        GTEST_SKIP() << "built without zstd";
+    }
+    std::string expected = "<AUTOSAR>";
+    for (int it = 0; it < 16; ++it) {
+        expected += "<AR-PACKAGES/>";
+    }
+    expected += "</AUTOSAR>";
+    auto path = writeFile("input_source_test.arxml.zst", ZSTD_FRAME);
+    auto source = arxml::utilities::io::open_file_source(path);
+    EXPECT_EQ(expected, source->getContent());
+
+    std::filesystem::resize_file(path, ZSTD_FRAME.size() - 10);
+    auto truncated = arxml::utilities::io::open_file_source(path);
+    EXPECT_THROW(truncated->getContent(), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(InputSourceTest, RecognisesCompressedModelFiles) {
+    using arxml::utilities::io::Compression;
+    using arxml::utilities::io::model_file_compression;
+    EXPECT_EQ(Compression::NONE, model_file_compression("dir/model.arxml"));
+    EXPECT_EQ(Compression::GZIP, model_file_compression("dir/model.arxml.gz"));
+    EXPECT_EQ(Compression::ZSTD, model_file_compression("dir/model.arxml.zst"));
+    EXPECT_FALSE(model_file_compression("dir/notes.txt.gz"));
+    EXPECT_EQ("dir/model.arxml", arxml::utilities::io::uncompressed_name("dir/model.arxml.zst"));
+}
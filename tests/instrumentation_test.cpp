@@ -0,0 +1,101 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <arxml/utilities/instrumentation.hpp>
+
+namespace {
+    using namespace arxml::utilities::instrumentation;
+    using namespace std::chrono_literals;
+
+    std::uint64_t milliseconds(const UnitProfile& unit, Phase phase) {
+        return unit.nanoseconds[static_cast<std::size_t>(phase)].load() / 1'000'000;
+    }
+
+    std::uint64_t counter(const UnitProfile& unit, Counter counter) {
+        return unit.counters[static_cast<std::size_t>(counter)].load();
+    }
+
+    // Profiler is a process wide singleton, every test enables it only for its own duration
+    class InstrumentationTest : public ::testing::Test {
+    protected:
+        void SetUp() override { Profiler::instance().enable(true); }
+        void TearDown() override { Profiler::instance().enable(false); }
+    };
+}
+
+TEST_F(InstrumentationTest, AccumulatesPhasesAndCountersPerUnit) {
+    UnitProfile* first = nullptr;
+    UnitProfile* second = nullptr;
+    {
+        UnitScope scope("first.arxml");
+        first = &current_unit();
+        count(Counter::BYTES, 100);
+        ScopedTimer timer(Phase::READ);
+        std::this_thread::sleep_for(10ms);
+    }
+    {
+        UnitScope scope("second.arxml");
+        second = &current_unit();
+        count(Counter::BYTES, 20);
+        count(Counter::BYTES, 3);
+    }
+    EXPECT_EQ(&Profiler::instance().globalUnit(), &current_unit());
+    EXPECT_EQ("first.arxml", first->name);
+    EXPECT_EQ(100, counter(*first, Counter::BYTES));
+    EXPECT_LE(10, milliseconds(*first, Phase::READ));
+    EXPECT_EQ("second.arxml", second->name);
+    EXPECT_EQ(23, counter(*second, Counter::BYTES));
+    EXPECT_EQ(0, milliseconds(*second, Phase::READ));
+}
+
+TEST_F(InstrumentationTest, NestedTimerPausesEnclosingOne) {
+    UnitScope scope("nested.arxml");
+    auto& unit = current_unit();
+    {
+        ScopedTimer outer(Phase::MODEL_BUILDING);
+        std::this_thread::sleep_for(10ms);
+        {
+            ScopedTimer inner(Phase::ALLOCATION);
+            std::this_thread::sleep_for(100ms);
+        }
+    }
+    EXPECT_LE(100, milliseconds(unit, Phase::ALLOCATION));
+    EXPECT_LE(10, milliseconds(unit, Phase::MODEL_BUILDING));
+    // Time of the inner timer is not counted again in the outer one
+    EXPECT_GT(100, milliseconds(unit, Phase::MODEL_BUILDING));
+}
+
+TEST_F(InstrumentationTest, MacrosRecordIntoCurrentUnit) {
+    if (not PROFILING_AVAILABLE) {
+        GTEST_SKIP() << "built without ARXML_ENABLE_PROFILING";
+    }
+    UnitProfile* unit = nullptr;
+    {
+        ARXML_PROFILE_UNIT("macro.arxml");
+        unit = &current_unit();
+        ARXML_PROFILE_SCOPE(Phase::XML_PARSING);
+        ARXML_PROFILE_COUNT(Counter::PACKAGES, 2);
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ("macro.arxml", unit->name);
+    EXPECT_EQ(2, counter(*unit, Counter::PACKAGES));
+    EXPECT_LE(5, milliseconds(*unit, Phase::XML_PARSING));
+}
+
+TEST_F(InstrumentationTest, DisabledProfilerRecordsNothing) {
+    Profiler::instance().enable(false);
+    UnitScope scope("disabled.arxml");
+    auto& global = Profiler::instance().globalUnit();
+    EXPECT_EQ(&global, &current_unit());
+    auto before = global.nanoseconds[static_cast<std::size_t>(Phase::TRAVERSAL)].load();
+    {
+        ScopedTimer timer(Phase::TRAVERSAL);
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(before, global.nanoseconds[static_cast<std::size_t>(Phase::TRAVERSAL)].load());
+}
@@ -0,0 +1,103 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <arxml/utilities/model_memory.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+          <CATEGORY>VALUE</CATEGORY>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+}
+
+TEST(ModelMemoryTest, ReusesMemoryForTheNextLoad) {
+    arxml::utilities::ModelMemoryResource memory;
+    arxml::utilities::parser::ModelComponentFactory factory(memory);
+    auto model = arxml::test::parseFiles({{"model.arxml", MODEL}}, factory);
+    EXPECT_LT(0, memory.live());
+    EXPECT_THROW(memory.release(), std::logic_error);
+
+    model.reset();
+    EXPECT_EQ(0, memory.live());
+    auto reserved = memory.bytesReserved();
+    memory.release();
+
+    model = arxml::test::parseFiles({{"model.arxml", MODEL}}, factory);
+    EXPECT_EQ(reserved, memory.bytesReserved());
+    const auto& elements = model->getModelEntry("model.arxml").getPackages().front()->getElements().getElements();
+    ASSERT_EQ(1, elements.size());
+    EXPECT_EQ("Type", elements.front()->getName());
+    EXPECT_EQ(&memory, arxml::utilities::ModelMemoryResource::owner(elements.front().get()));
+    model.reset();
+    memory.release();
+}
+
+TEST(ModelMemoryTest, KeepsChunkOfEveryResourceWhenSwitchingBetweenThem) {
+    arxml::utilities::ModelMemoryResource first;
+    arxml::utilities::ModelMemoryResource second;
+    for (int it = 0; it < 100; ++it) {
+        first.deallocate(first.allocate(64));
+        second.deallocate(second.allocate(64));
+    }
+    EXPECT_EQ(arxml::utilities::ModelMemoryResource::CHUNK_SIZE, first.bytesReserved());
+    EXPECT_EQ(arxml::utilities::ModelMemoryResource::CHUNK_SIZE, second.bytesReserved());
+}
+
+TEST(ModelMemoryTest, FindsOwnerAnywhereInLargeAllocations) {
+    using arxml::utilities::ModelMemoryResource;
+    const void* inside = nullptr;
+    {
+        ModelMemoryResource memory;
+        auto* large = static_cast<std::byte*>(memory.allocate(ModelMemoryResource::CHUNK_SIZE * 3 / 2));
+        inside = large + ModelMemoryResource::CHUNK_SIZE + 16;
+        EXPECT_EQ(&memory, ModelMemoryResource::owner(large));
+        EXPECT_EQ(&memory, ModelMemoryResource::owner(inside));
+        memory.deallocate(large);
+    }
+    // Only the address is looked up, the memory is not touched
+    EXPECT_EQ(nullptr, ModelMemoryResource::owner(inside));
+}
+
+TEST(ModelMemoryTest, HeapNodesHaveNoOwner) {
+    arxml::utilities::ModelMemoryResource memory;
+    auto* pointer = memory.allocate(64);
+    auto model = arxml::test::parseModel(MODEL);
+    EXPECT_EQ(&memory, arxml::utilities::ModelMemoryResource::owner(pointer));
+    EXPECT_EQ(nullptr, arxml::utilities::ModelMemoryResource::owner(&model->getModelEntry("model.arxml")));
+    memory.deallocate(pointer);
+}
+
+TEST(ModelMemoryTest, DestroysDeepModelsWithoutRecursion) {
+    arxml::utilities::parser::ModelComponentFactory factory;
+    auto named = factory.createNamedCompositeElement("DATA-TYPE", "Deep");
+    arxml::model::ICompositeAutosarElement* parent = named.get();
+    for (int it = 0; it < 1'000'000; ++it) {
+        auto child = factory.createCompositeElement("SUB");
+        auto* next = child.get();
+        parent->addSubElement(std::move(child));
+        parent = next;
+    }
+    auto elements = factory.createElements();
+    elements->addElement(std::move(named));
+    auto entry = factory.createModelEntry("deep.arxml", "", "", "");
+    entry->addPackage(factory.createPackage("apd", std::move(elements)));
+    auto model = factory.createRoot();
+    model->registerModelEntry("deep.arxml", std::move(entry));
+    model.reset();
+}
@@ -0,0 +1,75 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/helpers/model_stats.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* TYPES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+          <CATEGORY>VALUE</CATEGORY>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* SERVICES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <DESC>Text too long to be stored inside the string object</DESC>
+          <TYPE-TREF DEST="DATA-TYPE" BASE="apd">/apd/Type</TYPE-TREF>
+        </SERVICE-INTERFACE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+}
+
+TEST(ModelStatsTest, CountsNodesAndBytesPerFile) {
+    using arxml::model::EntryType;
+    auto model = arxml::test::parseFiles({{"types.arxml", TYPES}, {"services.arxml", SERVICES}});
+    auto stats = arxml::helpers::ModelStats::collect(*model);
+
+    EXPECT_EQ(1, stats.count(EntryType::AUTOSAR));
+    EXPECT_EQ(2, stats.count(EntryType::PACKAGES));
+    EXPECT_EQ(2, stats.count(EntryType::PACKAGE));
+    EXPECT_EQ(2, stats.count(EntryType::ELEMENTS));
+    EXPECT_EQ(2, stats.count(EntryType::NAMED_ELEMENT));
+    EXPECT_EQ(2, stats.count(EntryType::STRING_ELEMENT));
+    EXPECT_EQ(1, stats.count(EntryType::REFERENCE_ELEMENT));
+
+    auto tags = stats.getTags();
+    ASSERT_EQ(5, tags.size());
+    EXPECT_EQ("CATEGORY", tags[0].first.view());
+    EXPECT_EQ(1, tags[0].second);
+
+    const auto& files = stats.getFiles();
+    ASSERT_EQ(2, files.size());
+    EXPECT_EQ("services.arxml", files[0].file);
+    EXPECT_EQ(6, files[0].footprint.nodes);
+    EXPECT_EQ(5, files[1].footprint.nodes);
+    EXPECT_LT(0, files[0].footprint.string_bytes);
+    EXPECT_LT(0, files[0].footprint.attribute_bytes);
+    EXPECT_EQ(0, files[1].footprint.attribute_bytes);
+
+    auto sum = files[0].footprint;
+    sum += files[1].footprint;
+    EXPECT_EQ(12, stats.total().nodes);
+    EXPECT_EQ(sum.nodes + 1, stats.total().nodes);
+    EXPECT_LT(sum.bytes(), stats.total().bytes());
+}
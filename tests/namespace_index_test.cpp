@@ -0,0 +1,74 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/helpers/namespace_index.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL_TEMPLATE = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>@NAME@</SHORT-NAME>
+        </DATA-TYPE>
+        <DATA-TYPE>
+          <SHORT-NAME>Shared</SHORT-NAME>
+          <CATEGORY>@CATEGORY@</CATEGORY>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::unique_ptr<arxml::model::IAutosarModel> parse(const std::vector<std::pair<std::string, std::string>>& files) {
+        arxml::test::ModelFiles contents;
+        for (const auto& [file, name]: files) {
+            std::string content = MODEL_TEMPLATE;
+            content.replace(content.find("@NAME@"), 6, name);
+            content.replace(content.find("@CATEGORY@"), 10, file == "c.arxml" ? "OTHER" : "VALUE");
+            contents.emplace_back(file, std::move(content));
+        }
+        return arxml::test::parseFiles(contents, true);
+    }
+}
+
+TEST(NamespaceIndexTest, MergesPackagesAcrossEntries) {
+    auto model = parse({{"a.arxml", "First"}, {"b.arxml", "Second"}});
+    auto index = arxml::helpers::NamespaceIndex::build(*model);
+
+    auto apd = index.find("/apd");
+    ASSERT_TRUE(apd);
+    EXPECT_EQ(2, index[*apd].definitions.size());
+    std::vector<std::string> children;
+    for (auto child: index[*apd].children) {
+        children.push_back(index.path(child));
+    }
+    EXPECT_EQ((std::vector<std::string>{"/apd/First", "/apd/Shared", "/apd/Second"}), children);
+
+    auto second = index.find("/apd/Second");
+    ASSERT_TRUE(second);
+    EXPECT_EQ("b.arxml", index[*second].definitions.front().entry->getEntryName());
+    EXPECT_FALSE(index.find("/apd/Third"));
+    EXPECT_FALSE(index.find("/apd/First/Nested"));
+}
+
+TEST(NamespaceIndexTest, SeparatesIdenticalAndConflictingDuplicates) {
+    auto identical = parse({{"a.arxml", "First"}, {"b.arxml", "Second"}});
+    auto index = arxml::helpers::NamespaceIndex::build(*identical);
+    ASSERT_EQ(1, index.getDuplicates().size());
+    EXPECT_EQ("/apd/Shared", index.path(index.getDuplicates().front().node));
+    EXPECT_FALSE(index.getDuplicates().front().conflicting);
+
+    auto conflicting = parse({{"a.arxml", "First"}, {"c.arxml", "First"}});
+    index = arxml::helpers::NamespaceIndex::build(*conflicting);
+    ASSERT_EQ(2, index.getDuplicates().size());
+    EXPECT_FALSE(index.getDuplicates()[0].conflicting);
+    EXPECT_EQ("/apd/Shared", index.path(index.getDuplicates()[1].node));
+    EXPECT_TRUE(index.getDuplicates()[1].conflicting);
+}
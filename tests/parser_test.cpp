@@ -0,0 +1,102 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <arxml/attributes.hpp>
+#include <arxml/utilities/arxml_parser.hpp>
+#include <arxml/utilities/diagnostics.hpp>
+
+namespace {
+    const char* BROKEN_MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <ELEMENTS/>
+    </AR-PACKAGE>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <EVENTS/>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+          <CATEGORY>VALUE</CATEGORY>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* MALFORMED_XML = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::string format(const arxml::utilities::Diagnostic& diagnostic) {
+        std::ostringstream os;
+        os << diagnostic;
+        return os.str();
+    }
+}
+
+TEST(ParserTest, SkipsBrokenSubtreesAndReportsThem) {
+    using arxml::utilities::Severity;
+    arxml::utilities::Diagnostics diagnostics;
+    arxml::utilities::parser::ModelComponentFactory factory;
+    arxml::utilities::parser::ArxmlFileParser parser(factory);
+    parser.setDiagnostics(diagnostics);
+    arxml::utilities::io::StringSource source(BROKEN_MODEL);
+    parser.parseSource("model.arxml", source);
+    auto model = parser.build();
+
+    const auto& packages = model->getModelEntry("model.arxml").getPackages();
+    ASSERT_EQ(1, packages.size());
+    const auto& elements = packages.front()->getElements().getElements();
+    ASSERT_EQ(1, elements.size());
+    EXPECT_EQ("Type", elements.front()->getName());
+
+    auto reported = diagnostics.get();
+    ASSERT_EQ(3, reported.size());
+    EXPECT_EQ("model.arxml:2: warning: missing xsi:schemaLocation attribute", format(reported[0]));
+    EXPECT_EQ("model.arxml:4: error: AR-PACKAGE without SHORT-NAME, AR-PACKAGE skipped", format(reported[1]));
+    EXPECT_EQ("model.arxml:10: error: SERVICE-INTERFACE without SHORT-NAME, SERVICE-INTERFACE skipped",
+              format(reported[2]));
+    EXPECT_EQ(2, diagnostics.count(Severity::ERROR));
+}
+
+TEST(ParserTest, SkipsMalformedFileAndKeepsOthers) {
+    using arxml::utilities::Severity;
+    arxml::utilities::Diagnostics diagnostics;
+    arxml::utilities::parser::ModelComponentFactory factory;
+    arxml::utilities::parser::ArxmlFileParser parser(factory);
+    parser.setDiagnostics(diagnostics);
+    arxml::utilities::io::StringSource malformed(MALFORMED_XML);
+    parser.parseSource("malformed.arxml", malformed);
+    arxml::utilities::io::StringSource broken(BROKEN_MODEL);
+    parser.parseSource("model.arxml", broken);
+    auto model = parser.build();
+
+    EXPECT_EQ(1, model->getModelUnits().size());
+    EXPECT_NO_THROW(model->getModelEntry("model.arxml"));
+    auto reported = diagnostics.get();
+    ASSERT_FALSE(reported.empty());
+    EXPECT_EQ("malformed.arxml", reported.front().file);
+    EXPECT_EQ(Severity::ERROR, reported.front().severity);
+    EXPECT_NE(std::string::npos, reported.front().message.find("file skipped"));
+}
+
+TEST(ParserTest, KeepsAttributeValuesOutOfSymbolTable) {
+    arxml::model::AttributeList attributes;
+    attributes.add("DEST", "value seen only by this test");
+    attributes.add("BASE", std::string(64, 'x'));
+    EXPECT_EQ("value seen only by this test", attributes.find("DEST"));
+    EXPECT_EQ(std::string(64, 'x'), attributes.find("BASE"));
+    EXPECT_TRUE(arxml::utilities::SymbolTable::instance().find("value seen only by this test").empty());
+    EXPECT_LE(65, attributes.bytes());
+}
@@ -0,0 +1,78 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/helpers/path_trie.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* SERVICES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Services</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Server</SHORT-NAME>
+        </SERVICE-INTERFACE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* TYPES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+        <DATA-TYPE>
+          <SHORT-NAME>Serial</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::vector<std::string> paths(const std::vector<arxml::helpers::PathTrie::Completion>& completions) {
+        std::vector<std::string> result;
+        for (const auto& completion: completions) {
+            result.push_back(completion.path);
+        }
+        return result;
+    }
+}
+
+TEST(PathTrieTest, CompletesAndEnumeratesMergedPathsInNameOrder) {
+    auto model = arxml::test::parseFiles({{"services.arxml", SERVICES}, {"types.arxml", TYPES}});
+    auto trie = arxml::helpers::PathTrie::build(*model);
+
+    EXPECT_EQ(7, trie.size());
+    EXPECT_EQ((std::vector<std::string>{"/apd/Serial", "/apd/Server", "/apd/Services"}), paths(trie.complete("/apd/Ser")));
+    EXPECT_EQ((std::vector<std::string>{"/apd/Serial", "/apd/Server"}), paths(trie.complete("/apd/Ser", 2)));
+    EXPECT_EQ((std::vector<std::string>{"/apd/Serial", "/apd/Server", "/apd/Services", "/apd/Services/Speed",
+                                        "/apd/Type"}), paths(trie.enumerate("/apd/")));
+    EXPECT_EQ((std::vector<std::string>{"/apd"}), paths(trie.complete("/")));
+    EXPECT_TRUE(trie.complete("/apd/X").empty());
+    EXPECT_TRUE(trie.complete("/none/").empty());
+
+    auto speed = trie.find("/apd/Services/Speed");
+    ASSERT_TRUE(speed);
+    EXPECT_EQ("VARIABLE-DATA-PROTOTYPE", trie[*speed].tag.view());
+    EXPECT_EQ("/apd/Services/Speed", trie.path(*speed));
+    EXPECT_TRUE(trie[*trie.find("/apd")].tag.empty());
+    EXPECT_FALSE(trie.find("/apd/Serv"));
+}
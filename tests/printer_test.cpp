@@ -0,0 +1,59 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <arxml/printer.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <DESC>say "hi"\now</DESC>
+          <MAJOR-VERSION>1</MAJOR-VERSION>
+          <TYPE-TREF DEST="DATA-TYPE">/apd/Type</TYPE-TREF>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+}
+
+TEST(JsonPrinterTest, WritesDocument) {
+    auto model = arxml::test::parseModel(MODEL);
+    std::ostringstream stream;
+    arxml::printer::JsonPrinter printer(stream);
+    printer.print(*model->getModelEntry("model.arxml").getPackages()[0]);
+    EXPECT_EQ(R"({"name":"apd","elements":[)"
+              R"({"tag":"SERVICE-INTERFACE","name":"Service","children":[)"
+              R"({"tag":"DESC","value":"say \"hi\"\\now"},{"tag":"MAJOR-VERSION","value":1},)"
+              R"({"tag":"TYPE-TREF","attributes":{"DEST":"DATA-TYPE"},"value":"/apd/Type"}]},)"
+              R"({"tag":"DATA-TYPE","name":"Type","children":[]}]})" "\n", stream.str());
+}
+
+TEST(JsonPrinterTest, WritesRecordPerTopLevelElement) {
+    auto model = arxml::test::parseModel(MODEL);
+    std::ostringstream stream;
+    arxml::printer::JsonPrinter printer(stream, arxml::printer::JsonFormat::NDJSON);
+    printer.print(*model);
+    std::istringstream lines(stream.str());
+    std::vector<std::string> records;
+    for (std::string line; std::getline(lines, line);) {
+        records.push_back(line);
+    }
+    ASSERT_EQ(2, records.size());
+    EXPECT_TRUE(records[0].starts_with(R"({"file":"model.arxml","path":"/apd/Service","tag":"SERVICE-INTERFACE",)"));
+    EXPECT_EQ(R"({"file":"model.arxml","path":"/apd/Type","tag":"DATA-TYPE","name":"Type","children":[]})", records[1]);
+}
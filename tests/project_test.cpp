@@ -0,0 +1,182 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <thread>
+
+#include <arxml/project.hpp>
+#include <arxml/utilities/arxml_parser.hpp>
+#include <arxml/utilities/diagnostics.hpp>
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    class SerialFacade {
+    public:
+        void parse(const std::string& filename) {
+            files.insert(filename);
+            order.push_back(filename);
+        }
+
+        std::set<std::string> files;
+        std::vector<std::string> order;
+    };
+
+    std::filesystem::path makeProjectDirectory() {
+        auto directory = std::filesystem::temp_directory_path() / "arxml_project_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory / "nested");
+        for (const auto& name: {"a.arxml", "nested/b.arxml", "nested/c.arxml"}) {
+            std::ofstream(directory / name) << MODEL << "\n";
+        }
+        std::ofstream(directory / "notes.txt") << "not a model";
+        return directory;
+    }
+}
+
+TEST(ProjectTest, BoundedQueueDrainsAfterClose) {
+    arxml::utilities::BoundedQueue<int> queue(2);
+    std::thread producer([&queue]() {
+        for (int it = 0; it < 5; ++it) {
+            queue.push(it);
+        }
+        queue.close();
+    });
+    int expected = 0;
+    while (auto item = queue.pop()) {
+        EXPECT_EQ(expected++, *item);
+    }
+    producer.join();
+    EXPECT_EQ(5, expected);
+    EXPECT_FALSE(queue.push(5));
+}
+
+TEST(ProjectTest, DiscoversDirectoriesWhileParsing) {
+    auto directory = makeProjectDirectory();
+    arxml::project::ModelProject project;
+    ASSERT_TRUE(project.addDirectory(directory.string()));
+    ASSERT_FALSE(project.addDirectory((directory / "missing").string()));
+
+    arxml::utilities::DefaultParserFacade parser;
+    arxml::project::ModelProject::openModelFromProject(project, parser);
+    auto model = parser.getModel();
+    std::set<std::string> entries;
+    for (const auto& [name, entry]: model->getModelUnits()) {
+        entries.insert(name);
+    }
+    EXPECT_EQ((std::set<std::string>{(directory / "a.arxml").string(), (directory / "nested/b.arxml").string(),
+                                      (directory / "nested/c.arxml").string()}), entries);
+
+    SerialFacade serial;
+    arxml::project::ModelProject::openModelFromProject(project, serial);
+    EXPECT_EQ(entries, serial.files);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ProjectTest, SelectsFilesByGlobsAndSchedulesLargestFirst) {
+    auto directory = makeProjectDirectory();
+    std::ofstream(directory / "nested/c.arxml", std::ios::app) << std::string(1024, ' ');
+    std::filesystem::create_directories(directory / "backup");
+    std::ofstream(directory / "backup/a.arxml") << MODEL << "\n";
+
+    arxml::project::ModelProject project;
+    ASSERT_TRUE(project.addDirectory(directory.string()));
+    project.addIncludePattern("**/*.arxml");
+    project.addExcludePattern("backup/**");
+    project.addExcludePattern("b.*");
+    EXPECT_TRUE(project.isSelected("a.arxml"));
+    EXPECT_FALSE(project.isSelected("backup/a.arxml"));
+    EXPECT_FALSE(project.isSelected("nested/b.arxml"));
+
+    SerialFacade serial;
+    arxml::project::ModelProject::openModelFromProject(project, serial);
+    EXPECT_EQ((std::vector<std::string>{(directory / "nested/c.arxml").string(), (directory / "a.arxml").string()}),
+              serial.order);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ProjectTest, ReportsCompressedFilesWhichCannotBeRead) {
+    using arxml::utilities::Diagnostics;
+    using arxml::utilities::Severity;
+    if (arxml::utilities::io::is_compression_available(arxml::utilities::io::Compression::ZSTD)) {
+        GTEST_SKIP() << "built with zstd";
+    }
+    auto directory = makeProjectDirectory();
+    std::ofstream(directory / "d.arxml.zst") << "not decompressed";
+    auto warnings = Diagnostics::instance().count(Severity::WARNING);
+    auto errors = Diagnostics::instance().count(Severity::ERROR);
+
+    // Discovered ones are skipped with a warning, explicitly added ones fail alone without stopping the load
+    arxml::project::ModelProject project;
+    ASSERT_TRUE(project.addDirectory(directory.string()));
+    SerialFacade serial;
+    arxml::project::ModelProject::openModelFromProject(project, serial);
+    EXPECT_EQ(3, serial.files.size());
+    EXPECT_EQ(warnings + 1, Diagnostics::instance().count(Severity::WARNING));
+
+    arxml::project::ModelProject files;
+    ASSERT_TRUE(files.addFile((directory / "a.arxml").string()));
+    ASSERT_TRUE(files.addFile((directory / "d.arxml.zst").string()));
+    arxml::utilities::DefaultParserFacade parser;
+    arxml::project::ModelProject::openModelFromProject(files, parser);
+    EXPECT_EQ(1, parser.getModel()->getModelUnits().size());
+    EXPECT_EQ(errors + 1, Diagnostics::instance().count(Severity::ERROR));
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ProjectTest, PackageFilterSkipsUncoveredTopLevelPackages) {
+    arxml::utilities::PackageFilter filter;
+    filter.addPrefix("/apd/Types");
+    using Match = arxml::utilities::PackageFilter::Match;
+    EXPECT_EQ(Match::ANCESTOR, filter.match({"apd"}));
+    EXPECT_EQ(Match::INSIDE, filter.match({"apd", "Types", "Base"}));
+    EXPECT_EQ(Match::NONE, filter.match({"apd", "TypesX"}));
+    EXPECT_EQ(Match::NONE, filter.match({"other"}));
+    EXPECT_THROW(filter.addPrefix("apd"), std::invalid_argument);
+
+    arxml::utilities::parser::ModelComponentFactory factory;
+    arxml::utilities::parser::ArxmlFileParser parser(factory);
+    arxml::utilities::PackageFilter other;
+    other.addPrefix("/other");
+    parser.setPackageFilter(other);
+    arxml::utilities::io::StringSource source(MODEL);
+    parser.parseSource("model.arxml", source);
+    auto model = parser.build();
+    EXPECT_TRUE(model->getModelEntry("model.arxml").getPackages().empty());
+}
+
+TEST(ProjectTest, PackageFilterIsPushedDownToElements) {
+    auto parse = [](std::string_view prefix) {
+        arxml::utilities::parser::ModelComponentFactory factory;
+        arxml::utilities::parser::ArxmlFileParser parser(factory);
+        arxml::utilities::PackageFilter filter;
+        filter.addPrefix(prefix);
+        parser.setPackageFilter(filter);
+        arxml::utilities::io::StringSource source(MODEL);
+        parser.parseSource("model.arxml", source);
+        return parser.build();
+    };
+    auto covered = parse("/apd/Type/SHORT-NAME");
+    const auto& packages = covered->getModelEntry("model.arxml").getPackages();
+    ASSERT_EQ(1, packages.size());
+    EXPECT_EQ(1, packages.front()->getElements().getElements().size());
+
+    auto uncovered = parse("/apd/Other");
+    EXPECT_TRUE(uncovered->getModelEntry("model.arxml").getPackages().empty());
+}
@@ -0,0 +1,127 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <arxml/dfs/multiplexer.hpp>
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/query.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <AR-PACKAGES>
+        <AR-PACKAGE>
+          <SHORT-NAME>ServiceInterfaces</SHORT-NAME>
+          <ELEMENTS>
+            <SERVICE-INTERFACE>
+              <SHORT-NAME>WithEvents</SHORT-NAME>
+              <CATEGORY>SERVICE</CATEGORY>
+              <EVENTS>
+                <VARIABLE-DATA-PROTOTYPE>
+                  <SHORT-NAME>Speed</SHORT-NAME>
+                  <TYPE-TREF DEST="DATA-TYPE">/apd/Float32</TYPE-TREF>
+                </VARIABLE-DATA-PROTOTYPE>
+              </EVENTS>
+            </SERVICE-INTERFACE>
+            <SERVICE-INTERFACE>
+              <SHORT-NAME>WithoutEvents</SHORT-NAME>
+              <CATEGORY>OTHER</CATEGORY>
+            </SERVICE-INTERFACE>
+          </ELEMENTS>
+        </AR-PACKAGE>
+      </AR-PACKAGES>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    class ElementCounter : public arxml::dfs::TraversalCallback {
+    public:
+        arxml::dfs::VisitResult visit(const arxml::model::IAutosarElement& element) override {
+            ++count;
+            return arxml::dfs::VisitResult::CONTINUE;
+        }
+        int count = 0;
+    };
+
+    std::vector<std::string> paths(const std::vector<arxml::helpers::QueryMatch>& matches) {
+        std::vector<std::string> result;
+        for (const auto& match: matches) {
+            result.push_back(match.path);
+        }
+        return result;
+    }
+}
+
+TEST(QueryTest, MatchesByNameAndTag) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto result = arxml::helpers::run_query(*model, "/apd/ServiceInterfaces/SERVICE-INTERFACE");
+    EXPECT_EQ((std::vector<std::string>{"/apd/ServiceInterfaces/WithEvents", "/apd/ServiceInterfaces/WithoutEvents"}),
+              paths(result));
+    EXPECT_TRUE(arxml::helpers::run_query(*model, "/ServiceInterfaces/SERVICE-INTERFACE").empty());
+}
+
+TEST(QueryTest, DescendantStepWithPredicateSelectsShortName) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto result = arxml::helpers::run_query(*model, "/apd/**/SERVICE-INTERFACE[EVENTS/VARIABLE-DATA-PROTOTYPE]/SHORT-NAME");
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ("/apd/ServiceInterfaces/WithEvents/SHORT-NAME", result[0].path);
+    EXPECT_EQ("WithEvents", result[0].value);
+}
+
+TEST(QueryTest, ValuePredicateAndSimpleElementValues) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto by_category = arxml::helpers::run_query(*model, "/**/*[CATEGORY='OTHER']");
+    EXPECT_EQ((std::vector<std::string>{"/apd/ServiceInterfaces/WithoutEvents"}), paths(by_category));
+    auto references = arxml::helpers::run_query(*model, "/**/TYPE-TREF");
+    ASSERT_EQ(1, references.size());
+    EXPECT_EQ("/apd/ServiceInterfaces/WithEvents/EVENTS/Speed/TYPE-TREF", references[0].path);
+    EXPECT_EQ("/apd/Float32", references[0].value);
+}
+
+TEST(QueryTest, ReferencesAreTypedAtParseTime) {
+    using arxml::utilities::intern;
+    auto model = arxml::test::parseModel(MODEL);
+    auto references = arxml::helpers::run_query(*model, "/**/TYPE-TREF");
+    ASSERT_EQ(1, references.size());
+    ASSERT_EQ(arxml::model::EntryType::REFERENCE_ELEMENT, references[0].object.getType());
+    auto& reference = dynamic_cast<const arxml::model::IReferenceAutosarElement&>(references[0].object);
+    EXPECT_EQ(intern("DATA-TYPE"), reference.getDestination());
+    EXPECT_EQ((std::vector{intern("apd"), intern("Float32")}), reference.getTargetSegments());
+    auto categories = arxml::helpers::run_query(*model, "/**/CATEGORY");
+    ASSERT_FALSE(categories.empty());
+    EXPECT_EQ(arxml::model::EntryType::STRING_ELEMENT, categories[0].object.getType());
+}
+
+TEST(QueryTest, RejectsMalformedQueries) {
+    EXPECT_THROW(arxml::helpers::CompiledQuery::compile("apd"), std::invalid_argument);
+    EXPECT_THROW(arxml::helpers::CompiledQuery::compile("/apd//x"), std::invalid_argument);
+    EXPECT_THROW(arxml::helpers::CompiledQuery::compile("/apd[EVENTS"), std::invalid_argument);
+    EXPECT_THROW(arxml::helpers::CompiledQuery::compile("/a*b"), std::invalid_argument);
+}
+
+TEST(QueryTest, MultiplexedQueriesShareSingleTraversal) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto by_tag = arxml::helpers::CompiledQuery::compile("/apd/*/SERVICE-INTERFACE");
+    auto by_reference = arxml::helpers::CompiledQuery::compile("/**/TYPE-TREF");
+    std::vector<arxml::helpers::QueryMatch> tag_result;
+    std::vector<arxml::helpers::QueryMatch> reference_result;
+    arxml::helpers::QueryMatcher tag_matcher(by_tag, tag_result);
+    arxml::helpers::QueryMatcher reference_matcher(by_reference, reference_result);
+    ElementCounter counter;
+    arxml::dfs::TraversalMultiplexer multiplexer;
+    multiplexer.addCallback(tag_matcher);
+    multiplexer.addCallback(reference_matcher);
+    multiplexer.addCallback(counter);
+    arxml::dfs::traverse_model(*model, multiplexer);
+    EXPECT_EQ(paths(arxml::helpers::run_query(*model, by_tag)), paths(tag_result));
+    EXPECT_EQ(paths(arxml::helpers::run_query(*model, by_reference)), paths(reference_result));
+    EXPECT_EQ(7, counter.count);
+}
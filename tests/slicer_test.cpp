@@ -0,0 +1,135 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <arxml/helpers/path_trie.hpp>
+#include <arxml/helpers/slicer.hpp>
+#include <arxml/printer.hpp>
+#include <arxml/utilities/diagnostics.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* SERVICES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <AR-PACKAGES>
+        <AR-PACKAGE>
+          <SHORT-NAME>Services</SHORT-NAME>
+          <ELEMENTS>
+            <SERVICE-INTERFACE>
+              <SHORT-NAME>Service</SHORT-NAME>
+              <MAJOR-VERSION>1</MAJOR-VERSION>
+              <EVENTS>
+                <VARIABLE-DATA-PROTOTYPE>
+                  <SHORT-NAME>Event</SHORT-NAME>
+                  <TYPE-TREF DEST="DATA-TYPE">/apd/Types/Struct/Member</TYPE-TREF>
+                </VARIABLE-DATA-PROTOTYPE>
+              </EVENTS>
+            </SERVICE-INTERFACE>
+            <SERVICE-INTERFACE>
+              <SHORT-NAME>Unused</SHORT-NAME>
+              <DESC>not referenced</DESC>
+            </SERVICE-INTERFACE>
+          </ELEMENTS>
+        </AR-PACKAGE>
+      </AR-PACKAGES>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* TYPES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <AR-PACKAGES>
+        <AR-PACKAGE>
+          <SHORT-NAME>Types</SHORT-NAME>
+          <ELEMENTS>
+            <DATA-TYPE>
+              <SHORT-NAME>Struct</SHORT-NAME>
+              <SUB-ELEMENTS>
+                <ELEMENT>
+                  <SHORT-NAME>Member</SHORT-NAME>
+                  <TYPE-TREF DEST="DATA-TYPE">/apd/Types/Type</TYPE-TREF>
+                </ELEMENT>
+              </SUB-ELEMENTS>
+            </DATA-TYPE>
+            <DATA-TYPE>
+              <SHORT-NAME>Type</SHORT-NAME>
+              <CATEGORY>VALUE</CATEGORY>
+            </DATA-TYPE>
+            <DATA-TYPE>
+              <SHORT-NAME>Other</SHORT-NAME>
+              <CATEGORY>VALUE</CATEGORY>
+            </DATA-TYPE>
+          </ELEMENTS>
+        </AR-PACKAGE>
+      </AR-PACKAGES>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::vector<std::string> paths(const arxml::model::IAutosarModel& model) {
+        std::vector<std::string> result;
+        for (const auto& completion: arxml::helpers::PathTrie::build(model).enumerate("/")) {
+            result.push_back(completion.path);
+        }
+        return result;
+    }
+}
+
+TEST(SlicerTest, CollectsReachableClosure) {
+    auto model = arxml::test::parseFiles({{"services.arxml", SERVICES}, {"types.arxml", TYPES}});
+    arxml::helpers::ModelSlicer slicer(*model);
+
+    // A reference into a nested element pulls in its top level element and what that one references
+    EXPECT_EQ((std::set<std::string>{"/apd/Services/Service", "/apd/Types/Struct", "/apd/Types/Type"}),
+              slicer.collectReachable({"/apd/Services/Service"}));
+    EXPECT_EQ((std::set<std::string>{"/apd/Types/Struct", "/apd/Types/Type"}),
+              slicer.collectReachable({"/apd/Types/Struct/Member"}));
+    EXPECT_EQ((std::set<std::string>{"/apd/Types/Other", "/apd/Types/Struct", "/apd/Types/Type"}),
+              slicer.collectReachable({"/apd/Types"}));
+    EXPECT_TRUE(slicer.collectReachable({"/apd/Missing"}).empty());
+}
+
+TEST(SlicerTest, MovesSliceOutAndPrintsItAsWellFormedModel) {
+    auto model = arxml::test::parseFiles({{"services.arxml", SERVICES}, {"types.arxml", TYPES}});
+    arxml::helpers::ModelSlicer slicer(*model);
+    arxml::utilities::parser::ModelComponentFactory factory;
+    auto sliced = slicer.slice({"/apd/Services/Service"}, factory);
+
+    std::vector<std::string> expected{"/apd", "/apd/Services", "/apd/Services/Service",
+                                      "/apd/Services/Service/Event", "/apd/Types", "/apd/Types/Struct",
+                                      "/apd/Types/Struct/Member", "/apd/Types/Type"};
+    EXPECT_EQ(expected, paths(*sliced));
+    // The source model keeps only what was not reachable
+    EXPECT_EQ((std::vector<std::string>{"/apd", "/apd/Services", "/apd/Services/Unused", "/apd/Types",
+                                        "/apd/Types/Other"}), paths(*model));
+
+    arxml::test::ModelFiles printed;
+    for (const auto& [name, entry]: sliced->getModelUnits()) {
+        std::ostringstream stream;
+        arxml::printer::ArxmlPrinter printer(stream);
+        printer.print(*entry);
+        printed.emplace_back(name, stream.str());
+    }
+    ASSERT_EQ(2, printed.size());
+    auto errors = arxml::utilities::Diagnostics::instance().count(arxml::utilities::Severity::ERROR);
+    auto reparsed = arxml::test::parseFiles(printed);
+    EXPECT_EQ(errors, arxml::utilities::Diagnostics::instance().count(arxml::utilities::Severity::ERROR));
+    EXPECT_EQ(expected, paths(*reparsed));
+    // Values, attributes and nesting survive the round trip
+    for (const auto& [name, content]: printed) {
+        std::ostringstream stream;
+        arxml::printer::ArxmlPrinter printer(stream);
+        printer.print(reparsed->getModelEntry(name));
+        EXPECT_EQ(content, stream.str());
+    }
+}
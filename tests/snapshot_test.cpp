@@ -0,0 +1,83 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/finders.hpp>
+#include <arxml/helpers/query.hpp>
+#include <arxml/snapshot.hpp>
+#include <arxml/utilities/arxml_parser.hpp>
+
+namespace {
+    constexpr int INTERFACES = 64;
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 50;
+
+    arxml::model::ModelSnapshot makeSnapshot() {
+        std::stringstream ss;
+        ss << R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+)";
+        for (int it = 0; it < INTERFACES; ++it) {
+            ss << "<SERVICE-INTERFACE><SHORT-NAME>Service" << it << "</SHORT-NAME>"
+               << "<EVENTS><VARIABLE-DATA-PROTOTYPE><SHORT-NAME>Event</SHORT-NAME>"
+               << "<TYPE-TREF DEST=\"DATA-TYPE\">/apd/Type" << it % 4 << "</TYPE-TREF>"
+               << "</VARIABLE-DATA-PROTOTYPE></EVENTS></SERVICE-INTERFACE>\n";
+        }
+        ss << "</ELEMENTS></AR-PACKAGE></AR-PACKAGES></AUTOSAR>";
+        arxml::utilities::parser::ModelComponentFactory factory;
+        arxml::utilities::parser::ArxmlFileParser parser(factory);
+        arxml::utilities::io::StringSource source(ss.str());
+        parser.parseSource("model.arxml", source);
+        return arxml::model::ModelSnapshot(parser.build());
+    }
+}
+
+TEST(SnapshotTest, ParallelFindersOnSharedSnapshot) {
+    auto snapshot = makeSnapshot();
+    auto query = arxml::helpers::CompiledQuery::compile("/apd/SERVICE-INTERFACE[EVENTS/*/TYPE-TREF='/apd/Type1']");
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < THREADS; ++thread) {
+        threads.emplace_back([snapshot, &query, &failures, thread]() {
+            for (int it = 0; it < ITERATIONS; ++it) {
+                auto local = snapshot;
+                auto id = "/apd/Service" + std::to_string((thread * ITERATIONS + it) % INTERFACES);
+                std::vector<std::reference_wrapper<const arxml::model::INamedAutosarElement>> by_id;
+                arxml::helpers::ElementByIdFinder id_finder(by_id, id);
+                arxml::dfs::traverse_model(*local, id_finder);
+
+                std::map<std::string, const arxml::model::INamedAutosarElement&> by_tag;
+                arxml::helpers::ElementByTagFinder tag_finder(by_tag, "SERVICE-INTERFACE");
+                arxml::dfs::traverse_model(*local, tag_finder);
+
+                std::vector<std::string> by_ref;
+                arxml::helpers::ElementByReferenceFinder reference_finder(by_ref, "/apd/Type2");
+                arxml::dfs::traverse_model(*local, reference_finder);
+
+                auto matches = arxml::helpers::run_query(*local, query);
+
+                bool correct = by_id.size() == 1 and "/apd/" + by_id[0].get().getName() == id
+                               and by_tag.size() == INTERFACES and by_ref.size() == INTERFACES / 4
+                               and matches.size() == INTERFACES / 4;
+                if (not correct) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, failures.load());
+    EXPECT_EQ(1, snapshot.useCount());
+}
@@ -0,0 +1,98 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <arxml/dfs/multiplexer.hpp>
+#include <arxml/dfs/traversal.hpp>
+#include <arxml/helpers/finders.hpp>
+#include <arxml/helpers/structure.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    constexpr auto MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>First</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Event</SHORT-NAME>
+              <TYPE-TREF DEST="STD-CPP-IMPLEMENTATION-DATA-TYPE">/apd/Float32</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Second</SHORT-NAME>
+          <NAMESPACES><SYMBOL-PROPS><SHORT-NAME>apd</SHORT-NAME><SYMBOL>apd</SYMBOL></SYMBOL-PROPS></NAMESPACES>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Event</SHORT-NAME>
+              <TYPE-TREF DEST="APPLICATION-PRIMITIVE-DATA-TYPE">/apd/Speed</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <STD-CPP-IMPLEMENTATION-DATA-TYPE>
+          <SHORT-NAME>Float32</SHORT-NAME>
+        </STD-CPP-IMPLEMENTATION-DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::vector<std::string_view> tags(const arxml::helpers::StructureEntry& entry) {
+        std::vector<std::string_view> result;
+        for (const auto& it: entry.entries) {
+            result.push_back(it->tag.view());
+        }
+        return result;
+    }
+}
+
+TEST(StructureTest, MergesStructureOfTopLevelElements) {
+    auto model = arxml::test::parseModel(MODEL);
+    arxml::helpers::StructureCollector collector;
+    arxml::dfs::traverse_model(*model, collector);
+
+    const auto& entries = collector.getEntries();
+    ASSERT_EQ(2, entries.size());
+    EXPECT_EQ("SERVICE-INTERFACE", entries.begin()->first);
+    const auto& interface = entries.at("SERVICE-INTERFACE");
+    EXPECT_EQ(2, interface.counter);
+    EXPECT_EQ((std::vector<std::string_view>{"SHORT-NAME", "EVENTS", "NAMESPACES"}), tags(interface));
+
+    const auto& prototype = *interface.entries[1]->entries[0];
+    EXPECT_EQ("VARIABLE-DATA-PROTOTYPE", prototype.tag.view());
+    ASSERT_EQ(2, prototype.entries.size());
+    const auto& reference = *prototype.entries[1];
+    EXPECT_EQ("TYPE-TREF", reference.tag.view());
+    ASSERT_EQ(2, reference.referenced_types.size());
+    EXPECT_EQ("STD-CPP-IMPLEMENTATION-DATA-TYPE", reference.referenced_types[0].view());
+    EXPECT_EQ("APPLICATION-PRIMITIVE-DATA-TYPE", reference.referenced_types[1].view());
+}
+
+TEST(StructureTest, SharesTraversalWithFinders) {
+    auto model = arxml::test::parseModel(MODEL);
+    arxml::helpers::StructureCollector alone;
+    arxml::dfs::traverse_model(*model, alone);
+
+    arxml::helpers::StructureCollector collector;
+    std::map<std::string, const arxml::model::INamedAutosarElement&> interfaces;
+    arxml::helpers::ElementByTagFinder finder(interfaces, "SERVICE-INTERFACE");
+    arxml::dfs::TraversalMultiplexer multiplexer;
+    multiplexer.addCallback(finder);
+    multiplexer.addCallback(collector);
+    arxml::dfs::traverse_model(*model, multiplexer);
+
+    EXPECT_EQ(2, interfaces.size());
+    ASSERT_EQ(alone.getEntries().size(), collector.getEntries().size());
+    for (const auto& [tag, entry]: alone.getEntries()) {
+        const auto& shared = collector.getEntries().at(tag);
+        EXPECT_EQ(entry.counter, shared.counter);
+        EXPECT_EQ(tags(entry), tags(shared));
+    }
+}
@@ -0,0 +1,42 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <arxml/utilities/arxml_parser.hpp>
+
+namespace arxml::test {
+
+    // File name and content of every model file, in parsing order
+    using ModelFiles = std::vector<std::pair<std::string, std::string>>;
+
+    inline std::unique_ptr<model::IAutosarModel> parseFiles(const ModelFiles& files,
+                                                            utilities::parser::ModelComponentFactory& factory,
+                                                            bool content_hashing = false) {
+        utilities::parser::ArxmlFileParser parser(factory);
+        parser.setContentHashing(content_hashing);
+        for (const auto& [name, content]: files) {
+            utilities::io::StringSource source(content);
+            parser.parseSource(name, source);
+        }
+        return parser.build();
+    }
+
+    inline std::unique_ptr<model::IAutosarModel> parseFiles(const ModelFiles& files, bool content_hashing = false) {
+        utilities::parser::ModelComponentFactory factory;
+        return parseFiles(files, factory, content_hashing);
+    }
+
+    // Single file named model.arxml
+    inline std::unique_ptr<model::IAutosarModel> parseModel(std::string_view content, bool content_hashing = false) {
+        return parseFiles({{"model.arxml", std::string(content)}}, content_hashing);
+    }
+
+}
@@ -0,0 +1,91 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <arxml/helpers/text_index.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    const char* MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:schemaLocation="r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>SpeedService</SHORT-NAME>
+          <CATEGORY>SERVICE</CATEGORY>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+              <TYPE-TREF DEST="DATA-TYPE">/apd/Float</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Float</SHORT-NAME>
+          <CATEGORY>SERVICE</CATEGORY>
+          <SIZE>32</SIZE>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    // Element of a type the index knows nothing about, it reports the interface default type
+    class GenericElement : public arxml::model::IAutosarElement {
+    public:
+        [[nodiscard]] std::string getTag() const noexcept override { return "ADMIN-DATA"; }
+        [[nodiscard]] arxml::utilities::Symbol getTagId() const noexcept override {
+            return arxml::utilities::intern("ADMIN-DATA");
+        }
+    };
+}
+
+TEST(TextIndexTest, FindsSubstringsOfNamesAndValuesInModelOrder) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto index = arxml::helpers::TextIndex::build(*model);
+
+    auto speed = index.find("peed");
+    ASSERT_EQ(2, speed.size());
+    EXPECT_EQ("/apd/SpeedService", speed[0].path);
+    EXPECT_EQ("SpeedService", speed[0].text);
+    EXPECT_EQ("/apd/SpeedService/EVENTS/Speed", speed[1].path);
+
+    auto floats = index.find("Float");
+    ASSERT_EQ(2, floats.size());
+    EXPECT_EQ("/apd/SpeedService/EVENTS/Speed/TYPE-TREF", floats[0].path);
+    EXPECT_EQ("/apd/Float", floats[0].text);
+    EXPECT_EQ("/apd/Float", floats[1].path);
+
+    auto categories = index.find("SERVICE");
+    ASSERT_EQ(2, categories.size());
+    EXPECT_EQ("/apd/SpeedService/CATEGORY", categories[0].path);
+    EXPECT_EQ("/apd/Float/CATEGORY", categories[1].path);
+
+    EXPECT_TRUE(index.find("32").empty());
+    EXPECT_TRUE(index.find("Speedy").empty());
+}
+
+TEST(TextIndexTest, RejectsEmptyPattern) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto index = arxml::helpers::TextIndex::build(*model);
+    EXPECT_THROW(index.find(""), std::invalid_argument);
+}
+
+TEST(TextIndexTest, SkipsElementsOfUnknownType) {
+    auto model = arxml::test::parseModel(MODEL);
+    auto& elements = model->getModelEntry("model.arxml").getPackages().front()->getElements().getElements();
+    dynamic_cast<arxml::model::ICompositeAutosarElement&>(*elements.front())
+            .addSubElement(std::make_unique<GenericElement>());
+    auto index = arxml::helpers::TextIndex::build(*model);
+
+    auto floats = index.find("Float");
+    ASSERT_EQ(2, floats.size());
+    EXPECT_EQ("/apd/Float", floats[1].path);
+    EXPECT_TRUE(index.find("ADMIN").empty());
+}
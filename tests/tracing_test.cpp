@@ -0,0 +1,23 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <arxml/utilities/tracing.hpp>
+
+TEST(TracingTest, CopiesDetailOfTemporary) {
+    using arxml::utilities::tracing::TraceRecorder;
+    using arxml::utilities::tracing::TraceScope;
+    TraceRecorder::instance().enable(true);
+    {
+        TraceScope scope("temporary", std::string("detail of a temporary ") + std::string(200, 'x'));
+    }
+    TraceRecorder::instance().enable(false);
+    std::ostringstream trace;
+    TraceRecorder::instance().write(trace);
+    auto detail = "\"detail\":\"detail of a temporary " + std::string(81, 'x') + "\"";
+    EXPECT_NE(std::string::npos, trace.str().find(detail));
+}
@@ -0,0 +1,88 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <arxml/dfs/traversal.hpp>
+
+#include "test_model.hpp"
+
+namespace {
+    constexpr auto MODEL = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR xmlns="http://autosar.org/schema/r4.0">
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>First</SHORT-NAME>
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Event</SHORT-NAME>
+              <TYPE-TREF DEST="STD-CPP-IMPLEMENTATION-DATA-TYPE">/apd/Float32</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Second</SHORT-NAME>
+        </SERVICE-INTERFACE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    // Records visits and closes of elements by tag, answers the visit of one tag with the given result
+    class RecordingCallback : public arxml::dfs::TraversalCallback {
+    public:
+        RecordingCallback(std::string tag, arxml::dfs::VisitResult result)
+        : m_tag{std::move(tag)}
+        , m_result{result}
+        {
+
+        }
+
+        arxml::dfs::VisitResult visit(const arxml::model::IAutosarElement& element) override {
+            events.push_back("visit " + std::string(element.getTagId().view()));
+            return element.getTagId().view() == m_tag ? m_result : arxml::dfs::VisitResult::CONTINUE;
+        }
+
+        void close(const arxml::model::IAutosarElement& element) override {
+            events.push_back("close " + std::string(element.getTagId().view()));
+        }
+
+        void close(const arxml::model::IAutosarPackage& package) override {
+            events.push_back("close package");
+        }
+
+        void close(const arxml::model::IAutosarModel& root) override {
+            events.push_back("close model");
+        }
+
+        std::vector<std::string> events;
+    private:
+        std::string m_tag;
+        arxml::dfs::VisitResult m_result;
+    };
+}
+
+TEST(TraversalTest, SkippedElementIsStillClosed) {
+    auto model = arxml::test::parseModel(MODEL);
+    RecordingCallback callback("EVENTS", arxml::dfs::VisitResult::SKIP_CHILDREN);
+    arxml::dfs::traverse_model(*model, callback);
+    EXPECT_EQ((std::vector<std::string>{"visit SERVICE-INTERFACE", "visit EVENTS", "close EVENTS",
+                                        "close SERVICE-INTERFACE", "visit SERVICE-INTERFACE",
+                                        "close SERVICE-INTERFACE", "close package", "close model"}),
+              callback.events);
+}
+
+TEST(TraversalTest, StoppedTraversalDeliversNothingMore) {
+    auto model = arxml::test::parseModel(MODEL);
+    RecordingCallback callback("TYPE-TREF", arxml::dfs::VisitResult::STOP);
+    arxml::dfs::traverse_model(*model, callback);
+    EXPECT_EQ((std::vector<std::string>{"visit SERVICE-INTERFACE", "visit EVENTS", "visit VARIABLE-DATA-PROTOTYPE",
+                                        "visit TYPE-TREF"}),
+              callback.events);
+}
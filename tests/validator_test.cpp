@@ -0,0 +1,89 @@
+//
+// Created by Paweł Jarosz on 19.10.2026.
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <arxml/utilities/validator.hpp>
+
+namespace {
+    const char* TYPES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    const char* SERVICES = R"(<?xml version="1.0" encoding="UTF-8"?>
+<AUTOSAR>
+  <AR-PACKAGES>
+    <AR-PACKAGE>
+      <SHORT-NAME>apd</SHORT-NAME>
+      <ELEMENTS>
+        <SERVICE-INTERFACE>
+          <SHORT-NAME>Service</SHORT-NAME>
+          <!-- <SHORT-NAME>Ignored</SHORT-NAME> -->
+          <EVENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Speed</SHORT-NAME>
+              <TYPE-TREF DEST="DATA-TYPE">/apd/Type</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>Unit</SHORT-NAME>
+              <TYPE-TREF DEST="DATA-TYPE">/apd/Missing</TYPE-TREF>
+            </VARIABLE-DATA-PROTOTYPE>
+          </EVENTS>
+        </SERVICE-INTERFACE>
+        <DATA-TYPE>
+          <SHORT-NAME>Type</SHORT-NAME>
+        </DATA-TYPE>
+        <DATA-TYPE/>
+      </ELEMENTS>
+    </AR-PACKAGE>
+  </AR-PACKAGES>
+</AUTOSAR>)";
+
+    std::vector<std::string> validate(const std::vector<std::pair<std::string, std::string>>& files) {
+        arxml::utilities::Diagnostics diagnostics;
+        arxml::utilities::StructureValidator validator(diagnostics);
+        for (const auto& [name, content]: files) {
+            std::istringstream input(content);
+            validator.validate(name, input);
+        }
+        validator.finish();
+        std::vector<std::string> result;
+        for (const auto& diagnostic: diagnostics.get()) {
+            std::ostringstream os;
+            os << diagnostic;
+            result.push_back(os.str());
+        }
+        return result;
+    }
+}
+
+TEST(ValidatorTest, ReportsDuplicatePathsAndDanglingReferencesAcrossFiles) {
+    std::vector<std::string> expected{
+        "services.arxml:17: error: dangling reference to /apd/Missing (DATA-TYPE)",
+        "services.arxml:24: error: DATA-TYPE without SHORT-NAME",
+        "types.arxml:7: error: duplicate path /apd/Type, first defined at services.arxml:21"};
+    EXPECT_EQ(expected, validate({{"types.arxml", TYPES}, {"services.arxml", SERVICES}}));
+    // The definition first in file and line order is kept, whichever file was validated first
+    EXPECT_EQ(expected, validate({{"services.arxml", SERVICES}, {"types.arxml", TYPES}}));
+}
+
+TEST(ValidatorTest, ReportsMalformedStructure) {
+    EXPECT_EQ(std::vector<std::string>{"bad.arxml:3: error: malformed XML: unexpected </AR-PACKAGES>, expected "
+                                       "</AR-PACKAGE>, rest of file skipped"},
+              validate({{"bad.arxml", "<AUTOSAR>\n<AR-PACKAGES><AR-PACKAGE>\n</AR-PACKAGES></AUTOSAR>"}}));
+    EXPECT_EQ((std::vector<std::string>{"root.arxml:1: error: root element ROOT instead of AUTOSAR",
+                                        "root.arxml:1: error: ROOT without AR-PACKAGES"}),
+              validate({{"root.arxml", "<ROOT/>"}}));
+}